@@ -23,13 +23,106 @@ struct correlate_f32 {
    * 1 in size to hold the full correlation result. Input expected and actual
    * data buffers must be at least correlated_len in size to hold the data prior
    * to correlation. Buffers are managed as ring buffers for dynamic data
-   * addition.
+   * addition. Leave both expected and actual NULL to correlate in place on the
+   * ring buffers' spans instead of copying into linear arrays.
    */
   float32_t *const correlated, *const expected, *const actual;
   struct ring_buf *const buf_expected, *const buf_actual;
   size_t correlated_len, expected_len, actual_len;
+  /*
+   * Optional scratch space for the FFT mode, three real transforms of the
+   * padded length. Leave NULL to always correlate directly.
+   */
+  float32_t *const scratch;
+  const size_t scratch_len;
+  /*
+   * Optional running lag sums for the streaming mode, one per lag from minus
+   * the actual capacity less one to plus the expected capacity less one.
+   * Leave NULL to correlate from scratch on every call.
+   */
+  float32_t *const sums;
 };
 
+/*!
+ * \brief Define a static correlate_f32 instance without linear copies.
+ * \details Same as \c CORRELATE_F32_DEFINE_STATIC but without the expected and
+ * actual arrays, saving two buffers' worth of floats. Correlation works in
+ * place on the ring buffers' contiguous spans.
+ * \param _name_ Name of the correlate_f32 instance.
+ * \param _size_ Size of the expected and actual data buffers.
+ */
+#define CORRELATE_F32_DEFINE_STATIC_IN_PLACE(_name_, _size_)                                       \
+  static float32_t _name_##_correlated[_size_ + _size_ - 1];                                       \
+  RING_BUF_DEFINE_STATIC(_name_##_buf_expected, sizeof(float[_size_]));                            \
+  RING_BUF_DEFINE_STATIC(_name_##_buf_actual, sizeof(float[_size_]));                              \
+  struct correlate_f32 _name_ = {                                                                  \
+      .correlated = _name_##_correlated,                                                           \
+      .buf_expected = &_name_##_buf_expected,                                                      \
+      .buf_actual = &_name_##_buf_actual,                                                          \
+  }
+
+/*!
+ * \brief Relative cost of FFT correlation.
+ * \details Correlation switches to the FFT mode when the direct cost, N*M
+ * multiply-accumulates, exceeds this weight times L*log2(L) for transform
+ * length L, provided the instance has scratch space. The default of three
+ * counts the three real transforms and ignores the linear spectral product.
+ * It puts the switch between 32 and 64 samples for equal lengths. Tune it for
+ * the target with the cycle counts from correlate_f32_bench_test.
+ */
+#ifndef CORRELATE_F32_FFT_COST
+#define CORRELATE_F32_FFT_COST 3U
+#endif
+
+/*!
+ * \brief Longest real FFT supported by CMSIS-DSP.
+ */
+#define CORRELATE_F32_FFT_LEN_MAX 4096U
+
+/*!
+ * \brief FFT length for a correlation length.
+ * \details Smallest real FFT length supported by CMSIS-DSP, from 32 to
+ * \c CORRELATE_F32_FFT_LEN_MAX, that holds \p _len_ elements without circular
+ * aliasing.
+ * \param _len_ Full correlation length, expected plus actual less one.
+ */
+#define CORRELATE_F32_FFT_LEN(_len_)                                                               \
+  ((_len_) <= 32U     ? 32U                                                                        \
+   : (_len_) <= 64U   ? 64U                                                                        \
+   : (_len_) <= 128U  ? 128U                                                                       \
+   : (_len_) <= 256U  ? 256U                                                                       \
+   : (_len_) <= 512U  ? 512U                                                                       \
+   : (_len_) <= 1024U ? 1024U                                                                      \
+   : (_len_) <= 2048U ? 2048U                                                                      \
+                      : CORRELATE_F32_FFT_LEN_MAX)
+
+/*!
+ * \brief Define a static correlate_f32 instance with FFT scratch space.
+ * \details Same as \c CORRELATE_F32_DEFINE_STATIC but adds scratch space for
+ * three transforms of \c CORRELATE_F32_FFT_LEN floats, e.g. 24 KiB for
+ * 1024-sample buffers.
+ * \param _name_ Name of the correlate_f32 instance.
+ * \param _size_ Size of the expected and actual data buffers, at most 2048.
+ */
+#define CORRELATE_F32_DEFINE_STATIC_FFT(_name_, _size_)                                            \
+  _Static_assert(_size_ + _size_ - 1 <= CORRELATE_F32_FFT_LEN_MAX,                                \
+                 "FFT correlation length exceeds CORRELATE_F32_FFT_LEN_MAX");                      \
+  static float32_t _name_##_correlated[_size_ + _size_ - 1];                                       \
+  static float32_t _name_##_expected[_size_];                                                      \
+  static float32_t _name_##_actual[_size_];                                                        \
+  static float32_t _name_##_scratch[3U * CORRELATE_F32_FFT_LEN(_size_ + _size_ - 1U)];             \
+  RING_BUF_DEFINE_STATIC(_name_##_buf_expected, sizeof(float[_size_]));                            \
+  RING_BUF_DEFINE_STATIC(_name_##_buf_actual, sizeof(float[_size_]));                              \
+  struct correlate_f32 _name_ = {                                                                  \
+      .correlated = _name_##_correlated,                                                           \
+      .expected = _name_##_expected,                                                               \
+      .actual = _name_##_actual,                                                                   \
+      .buf_expected = &_name_##_buf_expected,                                                      \
+      .buf_actual = &_name_##_buf_actual,                                                          \
+      .scratch = _name_##_scratch,                                                                 \
+      .scratch_len = sizeof(_name_##_scratch) / sizeof(float32_t),                                 \
+  }
+
 /*!
  * \brief Define a static correlate_f32 instance.
  * \param _name_ Name of the correlate_f32 instance.
@@ -49,8 +142,31 @@ struct correlate_f32 {
       .buf_actual = &_name_##_buf_actual,                                                          \
   }
 
+/*!
+ * \brief Define a static correlate_f32 instance with running lag sums.
+ * \details Same as \c CORRELATE_F32_DEFINE_STATIC_IN_PLACE but adds one
+ * running sum per lag for the streaming mode. Streaming never copies the
+ * samples out, so the instance has no linear copies.
+ * \param _name_ Name of the correlate_f32 instance.
+ * \param _size_ Size of the expected and actual data buffers.
+ */
+#define CORRELATE_F32_DEFINE_STATIC_STREAM(_name_, _size_)                                         \
+  static float32_t _name_##_correlated[_size_ + _size_ - 1];                                       \
+  static float32_t _name_##_sums[_size_ + _size_ - 1];                                             \
+  RING_BUF_DEFINE_STATIC(_name_##_buf_expected, sizeof(float[_size_]));                            \
+  RING_BUF_DEFINE_STATIC(_name_##_buf_actual, sizeof(float[_size_]));                              \
+  struct correlate_f32 _name_ = {                                                                  \
+      .correlated = _name_##_correlated,                                                           \
+      .buf_expected = &_name_##_buf_expected,                                                      \
+      .buf_actual = &_name_##_buf_actual,                                                          \
+      .sums = _name_##_sums,                                                                       \
+  }
+
 /*!
  * \brief Add expected 32-bit float data to correlate_f32 instance.
+ * \details With running lag sums, also updates every lag sum: subtracts the
+ * products of the evicted oldest sample, if the buffer is full, and adds the
+ * products of the new sample, costing one pass over the actual data.
  * \param correlate Correlate 32-bit float instance.
  * \param expected Expected 32-bit float data to add.
  * \returns 0 on success, negative error code on failure.
@@ -59,14 +175,46 @@ int correlate_add_expected_f32(struct correlate_f32 *correlate, float32_t expect
 
 /*!
  * \brief Add actual 32-bit float data to correlate_f32 instance.
+ * \details With running lag sums, also updates every lag sum, costing one
+ * pass over the expected data.
  * \param correlate Correlate 32-bit float instance.
  * \param actual Actual 32-bit float data to add.
  * \returns 0 on success, negative error code on failure.
  */
 int correlate_add_actual_f32(struct correlate_f32 *correlate, float32_t actual);
 
+/*!
+ * \brief Add a block of expected 32-bit float data to correlate_f32 instance.
+ * \details Evicts the oldest expected data as necessary in one step, rather than
+ * once per sample. A block longer than the expected buffer keeps its newest
+ * samples. With running lag sums, adds the kept samples one by one.
+ * \param correlate Correlate 32-bit float instance.
+ * \param expected Expected 32-bit float data to add.
+ * \param len Number of expected elements to add.
+ * \returns 0 on success, negative error code on failure.
+ */
+int correlate_add_expected_block_f32(struct correlate_f32 *correlate, const float32_t *expected,
+                                     size_t len);
+
+/*!
+ * \brief Add a block of actual 32-bit float data to correlate_f32 instance.
+ * \details Evicts the oldest actual data as necessary in one step, rather than
+ * once per sample. A block longer than the actual buffer keeps its newest
+ * samples. With running lag sums, adds the kept samples one by one.
+ * \param correlate Correlate 32-bit float instance.
+ * \param actual Actual 32-bit float data to add.
+ * \param len Number of actual elements to add.
+ * \returns 0 on success, negative error code on failure.
+ */
+int correlate_add_actual_block_f32(struct correlate_f32 *correlate, const float32_t *actual,
+                                   size_t len);
+
 /*!
  * \brief Perform correlation on the data in the correlate_f32 instance.
+ * \details Uses the running lag sums when the instance has them. Otherwise
+ * uses the FFT mode when the instance has enough scratch space and the
+ * direct cost outweighs \c CORRELATE_F32_FFT_COST, otherwise correlates
+ * directly. Both modes lay out the correlated data identically.
  * \param correlate Correlate 32-bit float instance.
  * \returns 0 on success, negative error code on failure.
  * \note Updates the correlated_len, expected_len, and actual_len fields.
@@ -74,6 +222,58 @@ int correlate_add_actual_f32(struct correlate_f32 *correlate, float32_t actual);
  */
 int correlate_f32(struct correlate_f32 *correlate);
 
+/*!
+ * \brief Perform direct correlation on the data in the correlate_f32 instance.
+ * \details Always correlates directly, whatever the lengths: using
+ * \c arm_correlate_f32 on the linear copies, or without them, one dot product
+ * per lag for each pair of contiguous runs in the ring buffers' spans.
+ * \param correlate Correlate 32-bit float instance.
+ * \retval 0 on success.
+ * \retval -EINVAL if there is no expected or actual data.
+ */
+int correlate_direct_f32(struct correlate_f32 *correlate);
+
+/*!
+ * \brief Perform FFT correlation on the data in the correlate_f32 instance.
+ * \details Zero-pads both sequences to a common power-of-two length,
+ * transforms them with \c arm_rfft_fast_f32, multiplies the expected spectrum
+ * by the conjugate of the actual spectrum and transforms back. Results match
+ * direct correlation to within single-precision rounding.
+ * \param correlate Correlate 32-bit float instance.
+ * \retval 0 on success.
+ * \retval -EINVAL if there is no expected or actual data.
+ * \retval -ENOMEM if the scratch space is missing or too small, or the
+ * correlation length exceeds \c CORRELATE_F32_FFT_LEN_MAX.
+ */
+int correlate_fft_f32(struct correlate_f32 *correlate);
+
+/*!
+ * \brief Perform streaming correlation on the data in the correlate_f32 instance.
+ * \details Lays out the running lag sums as correlated data, matching direct
+ * correlation, without multiplying anything. The cost of correlation moves
+ * into the adds, bounded per sample rather than quadratic per call. Only
+ * counts the samples, leaving any linear copies untouched.
+ * \param correlate Correlate 32-bit float instance.
+ * \retval 0 on success.
+ * \retval -EINVAL if there is no expected or actual data.
+ * \retval -ENOMEM if the instance has no running lag sums.
+ * \note Adding and subtracting products accumulates rounding error over time.
+ * Resynchronise from time to time using \c correlate_stream_sync_f32.
+ */
+int correlate_stream_f32(struct correlate_f32 *correlate);
+
+/*!
+ * \brief Resynchronise running lag sums.
+ * \details Recomputes the running lag sums from scratch by direct correlation
+ * of the data now in the expected and actual ring buffers, discarding any
+ * accumulated rounding error. Also required after resetting either ring
+ * buffer behind the instance's back.
+ * \param correlate Correlate 32-bit float instance.
+ * \retval 0 on success.
+ * \retval -ENOMEM if the instance has no running lag sums.
+ */
+int correlate_stream_sync_f32(struct correlate_f32 *correlate);
+
 /*!
  * \brief Get correlated 32-bit float data from a correlate_f32 instance.
  * \param correlate Correlate 32-bit float instance.
@@ -87,7 +287,8 @@ size_t correlate_get_correlated_f32(const struct correlate_f32 *correlate, float
  * \brief Get expected 32-bit float data from a correlate_f32 instance.
  * \param correlate Correlate 32-bit float instance.
  * \param expected Pointer to store address of expected data array. Can be NULL
- * to ignore, returning just the length.
+ * to ignore, returning just the length. The address is NULL for instances
+ * without linear copies.
  * \returns Length of the expected data array.
  */
 size_t correlate_get_expected_f32(const struct correlate_f32 *correlate, float32_t **expected);
@@ -96,7 +297,8 @@ size_t correlate_get_expected_f32(const struct correlate_f32 *correlate, float32
  * \brief Get actual 32-bit float data from a correlate_f32 instance.
  * \param correlate Correlate 32-bit float instance.
  * \param actual Pointer to store address of actual data array. Can be NULL to
- * ignore, returning just the length.
+ * ignore, returning just the length. The address is NULL for instances without
+ * linear copies.
  * \returns Length of the actual data array.
  */
 size_t correlate_get_actual_f32(const struct correlate_f32 *correlate, float32_t **actual);
@@ -160,5 +362,7 @@ int32_t correlate_peak_lag_f32(const struct correlate_f32 *correlate, float32_t
  * 1.0 indicates perfect positive correlation, -1.0 indicates perfect negative
  * correlation, and 0.0 indicates no correlation.
  * \note Avoids division by zero by checking against FLT_EPSILON.
+ * \note Instances without linear copies read the ring buffers, so normalise
+ * before adding more data.
  */
 int correlate_normalise_f32(struct correlate_f32 *correlate);
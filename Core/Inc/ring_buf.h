@@ -51,6 +51,32 @@ extern "C" {
 #define EMSGSIZE 115
 #endif
 
+#ifdef RING_BUF_INDEX_16
+#include <stdint.h>
+
+/*!
+ * \brief Ring buffer pointer difference type.
+ * \details Signed type used for pointer arithmetic within the ring buffer.
+ * Sixteen bits wide when \c RING_BUF_INDEX_16 is defined, which shrinks the
+ * zones to a third of their default size on 32-bit targets at the cost of
+ * limiting every ring buffer in the build to 32 KiB. Indices wrap; all
+ * arithmetic on them converts differences back to the index or size type.
+ */
+typedef int16_t ring_buf_ptrdiff_t;
+
+/*!
+ * \brief Ring buffer size type.
+ * \details Unsigned type used for sizes within the ring buffer.
+ */
+typedef uint16_t ring_buf_size_t;
+
+/*!
+ * \brief Maximum ring buffer size.
+ * \details Defines the maximum size of the ring buffer based on the minimum
+ * value of the pointer difference type.
+ */
+#define RING_BUF_SIZE_MAX ((ring_buf_size_t)INT16_MIN)
+#else
 /*!
  * \brief Ring buffer pointer difference type.
  * \details Signed type used for pointer arithmetic within the ring buffer.
@@ -69,6 +95,7 @@ typedef size_t ring_buf_size_t;
  * value of the pointer difference type.
  */
 #define RING_BUF_SIZE_MAX ((ring_buf_size_t)PTRDIFF_MIN)
+#endif
 
 /*!
  * \defgroup ring_buf_zone Ring Buffer Zone Access
@@ -119,6 +146,132 @@ struct ring_buf_zone {
  * \{
  */
 
+struct ring_buf;
+
+#ifdef RING_BUF_WATERMARK
+/*!
+ * \brief Ring buffer watermarks.
+ * \details Thresholds on the number of bytes put and acknowledged but not yet
+ * got and acknowledged, with notifications for crossing them. The put and get
+ * acknowledge functions call \c rise when an acknowledgement lifts the count
+ * from below \c high to \c high or more, and \c fall when one drops it from
+ * above \c low to \c low or less. Either function may be \c NULL. Fan-out
+ * readers notify as the underlying get zone follows the slowest of them; the
+ * lock-free single-producer single-consumer and multi-producer functions
+ * never notify.
+ *
+ * Notifications run in the acknowledging context, possibly an interrupt
+ * service routine; typically they only set a flag or pend a task so that the
+ * other side can sleep until there is work.
+ *
+ * Compiled in only when \c RING_BUF_WATERMARK is defined, in which case every
+ * translation unit that includes this header must define it. Without it,
+ * buffers carry no watermark pointer.
+ */
+struct ring_buf_watermark {
+  /*!
+   * \brief High watermark in bytes.
+   * \details For example, the size of one full block of samples.
+   */
+  ring_buf_size_t high;
+
+  /*!
+   * \brief Low watermark in bytes.
+   * \details For example, the level at which to start a refill.
+   */
+  ring_buf_size_t low;
+
+  /*!
+   * \brief Notifies a rise to the high watermark.
+   */
+  void (*rise)(struct ring_buf *buf, void *extra);
+
+  /*!
+   * \brief Notifies a fall to the low watermark.
+   */
+  void (*fall)(struct ring_buf *buf, void *extra);
+
+  /*!
+   * \brief Extra context pointer to pass to the notifications.
+   */
+  void *extra;
+};
+
+/*!
+ * \brief Notifies watermark crossings.
+ * \details Does nothing if the buffer has no watermarks.
+ * \param buf Ring buffer.
+ * \param before Number of acknowledged bytes outstanding before the latest
+ * acknowledgement.
+ */
+void ring_buf_watermark_notify(struct ring_buf *buf, ring_buf_size_t before);
+
+/*!
+ * \brief Notifies watermark crossings, if compiled in.
+ * \param _buf_ Ring buffer.
+ * \param _before_ Number of acknowledged bytes outstanding before the latest
+ * acknowledgement.
+ */
+#define RING_BUF_WATERMARK_NOTIFY(_buf_, _before_)                             \
+  ring_buf_watermark_notify((_buf_), (_before_))
+#else
+#define RING_BUF_WATERMARK_NOTIFY(_buf_, _before_) ((void)(_before_))
+#endif
+
+#ifdef RING_BUF_STATS
+/*!
+ * \brief Ring buffer statistics.
+ * \details Counters for sizing buffers and spotting back-pressure. Compiled
+ * in only when \c RING_BUF_STATS is defined, in which case every translation
+ * unit that includes this header must define it. Byte counters wrap.
+ */
+struct ring_buf_stats {
+  /*!
+   * \brief Largest number of acknowledged bytes outstanding.
+   */
+  ring_buf_size_t high_water;
+
+  /*!
+   * \brief Total bytes acknowledged by puts.
+   */
+  ring_buf_size_t put;
+
+  /*!
+   * \brief Total bytes acknowledged by gets.
+   * \details Includes bytes dropped by circular puts.
+   */
+  ring_buf_size_t got;
+
+  /*!
+   * \brief Number of claims clamped short of the requested size.
+   * \details Clamping happens at the end of the buffer space as well as when
+   * space runs out.
+   */
+  ring_buf_size_t short_claims;
+
+  /*!
+   * \brief Number of all-or-none puts rejected with \c -EMSGSIZE.
+   */
+  ring_buf_size_t rejects;
+
+  /*!
+   * \brief Total bytes overwritten by circular puts.
+   */
+  ring_buf_size_t drops;
+};
+
+/*!
+ * \brief Adds to a ring buffer statistic.
+ * \param _buf_ Ring buffer.
+ * \param _stat_ Name of the statistic.
+ * \param _add_ Amount to add.
+ */
+#define RING_BUF_STATS_ADD(_buf_, _stat_, _add_)                               \
+  ((_buf_)->stats._stat_ += (_add_))
+#else
+#define RING_BUF_STATS_ADD(_buf_, _stat_, _add_) ((void)0)
+#endif
+
 /*!
  * \brief Ring buffer instance.
  * \details Represents a ring buffer with its associated data and zones for
@@ -138,6 +291,15 @@ struct ring_buf {
    */
   ring_buf_size_t size;
 
+  /*!
+   * \brief Size mask for power-of-two sizes.
+   * \details Equals the size less one when the buffer uses masked indexing,
+   * otherwise zero. Masked indexing requires a power-of-two size; it replaces
+   * the compare-and-rebase steps in the claim and acknowledge functions with a
+   * bitwise AND. Zero selects the generic path for any size.
+   */
+  ring_buf_size_t mask;
+
   /*!
    * \brief Put zone.
    * \details Contains the zone for putting data in the ring buffer.
@@ -149,6 +311,22 @@ struct ring_buf {
    * \details Contains the zone for getting data in the ring buffer.
    */
   struct ring_buf_zone get;
+
+#ifdef RING_BUF_WATERMARK
+  /*!
+   * \brief Optional watermarks.
+   * \details \c NULL by default, in which case acknowledgements notify
+   * nothing.
+   */
+  const struct ring_buf_watermark *watermark;
+#endif
+
+#ifdef RING_BUF_STATS
+  /*!
+   * \brief Statistics.
+   */
+  struct ring_buf_stats stats;
+#endif
 };
 
 /*!
@@ -235,6 +413,7 @@ ring_buf_size_t ring_buf_put_claim(struct ring_buf *buf, void **space,
  * that the claim cannot span across the end of the buffer space. Buffer size
  * less the put zone's head \e clamps the claim size. It \e cannot exceed the
  * remaining contiguous space.
+ * Notifies a rise to the high watermark, if any and compiled in.
  * \param buf Ring buffer address.
  * \param size Number of bytes to acknowledge.
  * \retval 0 on successful put.
@@ -260,7 +439,8 @@ ring_buf_size_t ring_buf_get_claim(struct ring_buf *buf, void **space,
 
 /*!
  * \brief Acknowledges space claimed for getting data from a ring buffer.
- * \details Acknowledging a number of bytes advances the get zone.
+ * \details Acknowledging a number of bytes advances the get zone. Notifies a
+ * fall to the low watermark, if any and compiled in.
  * \param buf Ring buffer address.
  * \param size Number of bytes to acknowledge.
  * \retval 0 on successful get.
@@ -268,6 +448,47 @@ ring_buf_size_t ring_buf_get_claim(struct ring_buf *buf, void **space,
  */
 int ring_buf_get_ack(struct ring_buf *buf, ring_buf_size_t size);
 
+/*!
+ * \}
+ */
+
+/*!
+ * \defgroup ring_buf_zone_claim Zone-Level Ring Buffer Access
+ * \brief Claim and acknowledge functions for any zone of a ring buffer.
+ * \details The put and get functions apply these to the buffer's own put and
+ * get zones. Extensions that keep further zones over the same buffer space,
+ * for example additional readers, use them directly.
+ * \{
+ */
+
+/*!
+ * \brief Claims contiguous space within a zone.
+ * \details Advances the zone's head by at most \p size bytes, clamped to the
+ * contiguous space before the end of the buffer space and to \p limit.
+ * \param buf Ring buffer that the zone belongs to.
+ * \param zone Ring buffer zone.
+ * \param space Address of pointer to claimed space, or \c NULL to ignore.
+ * \param size Number of bytes to claim.
+ * \param limit Number of bytes available to the zone, used or free.
+ * \returns Number of bytes claimed.
+ */
+ring_buf_size_t ring_buf_zone_claim(const struct ring_buf *buf,
+                                    struct ring_buf_zone *zone, void **space,
+                                    ring_buf_size_t size,
+                                    ring_buf_size_t limit);
+
+/*!
+ * \brief Acknowledges claimed space within a zone.
+ * \details Advances the zone's tail and rebases the zone.
+ * \param buf Ring buffer that the zone belongs to.
+ * \param zone Ring buffer zone.
+ * \param size Number of bytes to acknowledge.
+ * \retval 0 on success.
+ * \retval -EINVAL if \c size exceeds previously claimed aggregate space.
+ */
+int ring_buf_zone_ack(const struct ring_buf *buf, struct ring_buf_zone *zone,
+                      ring_buf_size_t size);
+
 /*!
  * \}
  */
@@ -286,7 +507,7 @@ int ring_buf_get_ack(struct ring_buf *buf, ring_buf_size_t size);
  * out of free space.
  * \note Does \e not automatically acknowledge the space.
  * \param buf Ring buffer.
- * \param data Address of bytes to put.
+ * \param data Address of bytes to put, or \c NULL to claim without copying.
  * \param size Number of bytes to put.
  * \returns Buffer space to acknowledge in bytes.
  */
@@ -328,6 +549,211 @@ int ring_buf_put_all(struct ring_buf *buf, const void *data,
  */
 int ring_buf_get_all(struct ring_buf *buf, void *data, ring_buf_size_t size);
 
+/*!
+ * \}
+ */
+
+/*!
+ * \defgroup ring_buf_span Zero-Copy Ring Buffer Spans
+ * \brief Functions for viewing ring buffer space in place.
+ * \details A region of a ring buffer occupies at most two contiguous spans:
+ * one running up to the end of the buffer space and one starting again at its
+ * beginning. These functions describe both spans in one call without copying
+ * and without claiming, so callers can process data in place then claim and
+ * acknowledge once, for example:
+ * \code
+ * struct ring_buf_span spans[2];
+ * ring_buf_size_t used = ring_buf_used_spans(buf, spans);
+ * // ... process spans[0] then spans[1] in place ...
+ * (void)ring_buf_get_ack(buf, ring_buf_get(buf, NULL, used));
+ * \endcode
+ * \{
+ */
+
+/*!
+ * \brief Ring buffer span.
+ * \details One contiguous piece of ring buffer space. The second of a pair of
+ * spans has zero size when the region does not wrap around the end of the
+ * buffer space.
+ */
+struct ring_buf_span {
+  /*!
+   * \brief Address of the span's first byte.
+   */
+  void *space;
+
+  /*!
+   * \brief Number of bytes in the span.
+   */
+  ring_buf_size_t size;
+};
+
+/*!
+ * \brief Spans of used space.
+ * \details Describes the used space that the next get claim would cover, i.e.
+ * the data not yet claimed for getting.
+ * \param buf Ring buffer.
+ * \param spans Array of two spans to fill.
+ * \returns Total number of used bytes across both spans.
+ */
+ring_buf_size_t ring_buf_used_spans(const struct ring_buf *buf,
+                                    struct ring_buf_span spans[2]);
+
+/*!
+ * \brief Spans of free space.
+ * \details Describes the free space that the next put claim would cover.
+ * Callers can fill the spans in place then claim and acknowledge the bytes
+ * written using \c ring_buf_put with \c NULL data.
+ * \param buf Ring buffer.
+ * \param spans Array of two spans to fill.
+ * \returns Total number of free bytes across both spans.
+ */
+ring_buf_size_t ring_buf_free_spans(const struct ring_buf *buf,
+                                    struct ring_buf_span spans[2]);
+
+/*!
+ * \brief Slices a region out of a pair of spans.
+ * \details The region must lie within the pair.
+ * \param spans Pair of spans to slice, e.g. the used spans.
+ * \param offset Offset of the region within the pair.
+ * \param size Number of bytes in the region.
+ * \param slice Array of two spans to fill with the region.
+ */
+void ring_buf_span_slice(const struct ring_buf_span spans[2],
+                         ring_buf_size_t offset, ring_buf_size_t size,
+                         struct ring_buf_span slice[2]);
+
+/*!
+ * \brief Copies a region out of a pair of spans.
+ * \details The region must lie within the pair.
+ * \param spans Pair of spans to copy from.
+ * \param offset Offset of the region within the pair.
+ * \param data Address of bytes to fill.
+ * \param size Number of bytes to copy.
+ */
+void ring_buf_span_read(const struct ring_buf_span spans[2],
+                        ring_buf_size_t offset, void *data,
+                        ring_buf_size_t size);
+
+/*!
+ * \brief Spans of the newest bytes.
+ * \details Describes a sliding window over the latest \p size bytes put and
+ * acknowledged, without moving either zone. The window reaches back no
+ * further than the get zone's tail, so it covers bytes already claimed by a
+ * get but not yet acknowledged. Combined with circular puts that keep the
+ * buffer full, the window is the most recent history, e.g. for filters.
+ * \param buf Ring buffer.
+ * \param size Number of newest bytes wanted.
+ * \param spans Array of two spans to fill, oldest byte first.
+ * \returns Number of bytes in the window, at most \p size.
+ */
+ring_buf_size_t ring_buf_window_spans(const struct ring_buf *buf,
+                                      ring_buf_size_t size,
+                                      struct ring_buf_span spans[2]);
+
+/*!
+ * \brief Address of a recent byte.
+ * \details Looks back from the put zone's tail: offset -1 addresses the
+ * newest byte, -2 the one before, and so on. Does not move either zone.
+ * \param buf Ring buffer.
+ * \param offset Negative offset from the newest byte.
+ * \returns Address of the byte, or \c NULL if the offset is not negative or
+ * reaches back beyond the get zone's tail.
+ */
+void *ring_buf_at(const struct ring_buf *buf, ring_buf_ptrdiff_t offset);
+
+/*!
+ * \}
+ */
+
+/*!
+ * \defgroup ring_buf_vectored Vectored Ring Buffer Access
+ * \brief Scatter/gather functions for putting and getting multi-part data.
+ * \details Vectored puts gather several separate pieces of caller memory, for
+ * example a header and a payload, into one claim. Vectored gets scatter one
+ * claim into several pieces. Either way, the parts travel together: the
+ * functions put or get all parts or none, and the caller acknowledges the
+ * total once.
+ * \{
+ */
+
+/*!
+ * \brief Ring buffer I/O vector.
+ * \details Describes one piece of caller memory for vectored access, in the
+ * manner of POSIX \c struct \c iovec.
+ */
+struct ring_buf_iovec {
+  /*!
+   * \brief Address of the caller's data.
+   * \details Vectored puts only read the data. When \c NULL, puts skip over
+   * that part of the claim without writing it and gets discard that part.
+   */
+  void *data;
+
+  /*!
+   * \brief Number of bytes.
+   */
+  ring_buf_size_t size;
+};
+
+/*!
+ * \brief Puts all parts or none.
+ * \details Claims space for the total size of all parts, copies each part in
+ * turn, and answers the number of bytes to acknowledge.
+ * \param buf Ring buffer.
+ * \param iov Array of parts to put.
+ * \param iovcnt Number of parts.
+ * \retval Zero or greater, the number of bytes to acknowledge.
+ * \retval -EMSGSIZE if the parts together will not fit.
+ * \note Does \e not automatically acknowledge the space.
+ */
+int ring_buf_putv(struct ring_buf *buf, const struct ring_buf_iovec *iov,
+                  int iovcnt);
+
+/*!
+ * \brief Gets all parts or none.
+ * \details Claims the total size of all parts, copies into each part in turn,
+ * and answers the number of bytes to acknowledge.
+ * \param buf Ring buffer.
+ * \param iov Array of parts to fill.
+ * \param iovcnt Number of parts.
+ * \retval Zero or greater, the number of bytes to acknowledge.
+ * \retval -EAGAIN if insufficient data is available.
+ * \note Does \e not automatically acknowledge the space.
+ */
+int ring_buf_getv(struct ring_buf *buf, const struct ring_buf_iovec *iov,
+                  int iovcnt);
+
+/*!
+ * \brief Copies bytes in and out of ring buffer space.
+ * \details Moves 32-bit words, four at a time where possible, when source and
+ * destination share the same word alignment; copies bytes only up to the
+ * first word boundary and after the last. The four-word loop lets the
+ * compiler use load and store multiple bursts. Falls back to \c memcpy for
+ * mutually misaligned addresses.
+ *
+ * Nano newlib's \c memcpy optimises for size and copies one byte at a time,
+ * which costs roughly four times as many cycles for aligned bulk data.
+ * \param dst Destination address.
+ * \param src Source address.
+ * \param size Number of bytes to copy.
+ */
+void ring_buf_copy(void *dst, const void *src, ring_buf_size_t size);
+
+/*!
+ * \brief Copies between an I/O vector and a pair of claimed spans.
+ * \details Walks the parts and the spans in step. The spans must together
+ * cover the total size of the parts. Parts with \c NULL data skip over their
+ * share of the spans.
+ * \param spans Claimed spans; consumed by the copy.
+ * \param iov Array of parts.
+ * \param iovcnt Number of parts.
+ * \param put True to copy parts into the spans, false to copy out.
+ */
+void ring_buf_iovec_copy(struct ring_buf_span spans[2],
+                         const struct ring_buf_iovec *iov, int iovcnt,
+                         bool put);
+
 /*!
  * \}
  */
@@ -338,21 +764,42 @@ int ring_buf_get_all(struct ring_buf *buf, void *data, ring_buf_size_t size);
  * \brief Defines a static ring buffer.
  * \details This macro creates a ring buffer with the specified name and size.
  * It statically allocates the ring buffer's storage space as an array of
- * bytes.
+ * bytes, word-aligned so that copies in and out can move whole words.
  *
  * It correctly initialises the ring buffer structure with a pointer to the
  * allocated space and sets the size. The put and get zones are initialised to
  * zero by default. This assumes that the compiler will zero-initialise static
  * storage, i.e. allocated storage in the Blank Static Storage section. There is
- * not need to explicitly reset the ring buffer before use.
+ * not need to explicitly reset the ring buffer before use. Fails to compile if
+ * the size exceeds \c RING_BUF_SIZE_MAX.
  * \param _name_ Name of the ring buffer.
  * \param _size_ Size of the ring buffer.
  */
 #define RING_BUF_DEFINE_STATIC(_name_, _size_)                                 \
-  static uint8_t _ring_buf_space_##_name_[_size_];                             \
+  _Static_assert((_size_) <= RING_BUF_SIZE_MAX,                                \
+                 "ring buffer size exceeds RING_BUF_SIZE_MAX");                \
+  static _Alignas(uint32_t) uint8_t _ring_buf_space_##_name_[_size_];          \
   static struct ring_buf _name_ = {.space = _ring_buf_space_##_name_,          \
                                    .size = _size_}
 
+/*!
+ * \brief Defines a static power-of-two ring buffer.
+ * \details Same as \c RING_BUF_DEFINE_STATIC but also sets the size mask so
+ * that claims and acknowledgements take the masked fast path. Fails to compile
+ * if the size is not a power of two or exceeds \c RING_BUF_SIZE_MAX.
+ * \param _name_ Name of the ring buffer.
+ * \param _size_ Size of the ring buffer, a power of two.
+ */
+#define RING_BUF_DEFINE_STATIC_POW2(_name_, _size_)                            \
+  _Static_assert((_size_) <= RING_BUF_SIZE_MAX,                                \
+                 "ring buffer size exceeds RING_BUF_SIZE_MAX");                \
+  _Static_assert((_size_) != 0 && ((_size_) & ((_size_) - 1)) == 0,           \
+                 "ring buffer size must be a power of two");                   \
+  static _Alignas(uint32_t) uint8_t _ring_buf_space_##_name_[_size_];          \
+  static struct ring_buf _name_ = {.space = _ring_buf_space_##_name_,          \
+                                   .size = _size_,                             \
+                                   .mask = (_size_) - 1}
+
 /*!
  * \}
  */
@@ -0,0 +1,140 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: 2026, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+/*!
+ * \file ring_buf_bip.h
+ * \brief Bip-buffer ring buffer item function prototypes.
+ * \details Declares functions that keep every length-prefixed item
+ * contiguous in the buffer space so that consumers can parse or transfer it
+ * in place.
+ * \copyright 2026, Roy Ratcliffe, Northumberland, United Kingdom
+ *
+ * Permission is hereby granted, free of charge,  to any person obtaining a
+ * copy  of  this  software  and    associated   documentation  files  (the
+ * "Software"), to deal in  the   Software  without  restriction, including
+ * without limitation the rights to  use,   copy,  modify,  merge, publish,
+ * distribute, sublicense, and/or sell  copies  of   the  Software,  and to
+ * permit persons to whom the Software is   furnished  to do so, subject to
+ * the following conditions:
+ *
+ *     The above copyright notice and this permission notice shall be
+ *     included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT  WARRANTY OF ANY KIND, EXPRESS
+ * OR  IMPLIED,  INCLUDING  BUT  NOT   LIMITED    TO   THE   WARRANTIES  OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR   PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS  OR   COPYRIGHT  HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER   IN  AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM,  OUT  OF   OR  IN  CONNECTION  WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef __RING_BUF_BIP_H__
+#define __RING_BUF_BIP_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "ring_buf_item.h"
+
+/*!
+ * \defgroup ring_buf_bip Bip-Buffer Items
+ * \brief Length-prefixed items that never wrap.
+ * \details Items carry the same \c ring_buf_item_length_t prefix as the plain
+ * item functions, but a put never splits an item across the end of the
+ * buffer space. When the item does not fit before the end, the put skips the
+ * remaining bytes and writes the item at the start instead. A skip marker
+ * length of \c RING_BUF_BIP_SKIP records the skip, unless fewer bytes remain
+ * than a length prefix needs, in which case the skip is implicit.
+ *
+ * A get claim therefore always answers one contiguous pointer to the item.
+ * Skipped bytes count as used space until the consumer acknowledges them
+ * along with the item that follows.
+ * \note Do \e not mix bip-buffer items with plain items or plain puts on the
+ * same ring buffer.
+ * \{
+ */
+
+/*!
+ * \brief Skip marker.
+ * \details A length prefix with this value marks the rest of the buffer space
+ * as unused. Items cannot have this length.
+ */
+#define RING_BUF_BIP_SKIP ((ring_buf_item_length_t)~0U)
+
+/*!
+ * \brief Puts a contiguous item.
+ * \details Claims the length prefix and the item in one contiguous run,
+ * skipping to the start of the buffer space if necessary, and copies them.
+ * \param buf Address of the ring buffer.
+ * \param item Address of item to put.
+ * \param length Number of bytes to put.
+ * \returns Number of bytes to acknowledge on success, including any skipped
+ * bytes, or a negative error number.
+ * \retval -EMSGSIZE if the buffer has insufficient space to put the item
+ * contiguously, or the length equals \c RING_BUF_BIP_SKIP.
+ * \note Does \e not auto-acknowledge the put claim.
+ */
+int ring_buf_bip_put(struct ring_buf *buf, const void *item,
+                     ring_buf_item_length_t length);
+
+/*!
+ * \brief Claims space for an item in place.
+ * \details Reserves a contiguous item of up to \p length bytes so that a
+ * producer can serialise straight into the buffer space rather than into a
+ * separate buffer first. Commit the actual length afterwards; the length
+ * prefix is patched then.
+ * \param buf Address of the ring buffer.
+ * \param length Maximum number of bytes the item will need.
+ * \param item Address of pointer to the item's first byte within the buffer
+ * space.
+ * \retval 0 on success.
+ * \retval -EMSGSIZE if the buffer has insufficient space to claim the item
+ * contiguously, or the length equals \c RING_BUF_BIP_SKIP.
+ * \note Make no other puts between claim and commit.
+ */
+int ring_buf_bip_put_claim(struct ring_buf *buf, ring_buf_item_length_t length,
+                           void **item);
+
+/*!
+ * \brief Commits an item claimed in place.
+ * \details Patches the item's length prefix and acknowledges the item along
+ * with any skipped bytes before it. The unused remainder of the claim returns
+ * to free space.
+ * \param buf Address of the ring buffer.
+ * \param length Actual number of bytes in the item.
+ * \retval 0 on success.
+ * \retval -EINVAL if there is no claim or \p length exceeds the claimed
+ * maximum.
+ */
+int ring_buf_bip_put_commit(struct ring_buf *buf,
+                            ring_buf_item_length_t length);
+
+/*!
+ * \brief Claims the next item in place.
+ * \details Claims past any skipped bytes and the length prefix, then claims
+ * the item itself.
+ * \param buf Address of the ring buffer.
+ * \param item Address of pointer to the item's first byte within the buffer
+ * space.
+ * \param length Address of the length of the item on success.
+ * \returns Number of bytes to acknowledge on success, or a negative error
+ * number.
+ * \retval -EAGAIN if the buffer is empty.
+ * \note Acknowledge the answer with \c ring_buf_get_ack once done with the
+ * item. The item pointer is only valid until then.
+ */
+int ring_buf_bip_get_claim(struct ring_buf *buf, void **item,
+                           ring_buf_item_length_t *length);
+
+/*!
+ * \}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __RING_BUF_BIP_H__ */
@@ -48,4 +48,20 @@ struct ring_buf;
  */
 int ring_buf_put_circ(struct ring_buf *buf, void *data, size_t size);
 
+/*!
+ * \brief Put a block of data into a circular buffer.
+ * \details Removes exactly as much of the oldest data as the block needs, in
+ * one get and acknowledgement, then puts the block with at most two copies.
+ * A block larger than the buffer keeps only its newest bytes, filling the
+ * buffer.
+ * \param buf Ring buffer.
+ * \param data Address of bytes to put.
+ * \param size Number of bytes to put.
+ * \returns 0 on success, \c -EMSGSIZE if outstanding get claims prevent
+ * making space.
+ * \note Unlike \c ring_buf_put_circ, removal does not depend on the buffer
+ * size being a multiple of the block size.
+ */
+int ring_buf_put_circ_bulk(struct ring_buf *buf, const void *data, size_t size);
+
 #endif /* __RING_BUF_CIRC_H__ */
@@ -0,0 +1,134 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: 2026, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+/*!
+ * \file ring_buf_cobs.h
+ * \brief COBS-framed ring buffer function prototypes.
+ * \details Declares functions that encode frames with consistent overhead
+ * byte stuffing straight into ring buffer free space, and decode them
+ * straight out of the used spans.
+ * \copyright 2026, Roy Ratcliffe, Northumberland, United Kingdom
+ *
+ * Permission is hereby granted, free of charge,  to any person obtaining a
+ * copy  of  this  software  and    associated   documentation  files  (the
+ * "Software"), to deal in  the   Software  without  restriction, including
+ * without limitation the rights to  use,   copy,  modify,  merge, publish,
+ * distribute, sublicense, and/or sell  copies  of   the  Software,  and to
+ * permit persons to whom the Software is   furnished  to do so, subject to
+ * the following conditions:
+ *
+ *     The above copyright notice and this permission notice shall be
+ *     included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT  WARRANTY OF ANY KIND, EXPRESS
+ * OR  IMPLIED,  INCLUDING  BUT  NOT   LIMITED    TO   THE   WARRANTIES  OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR   PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS  OR   COPYRIGHT  HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER   IN  AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM,  OUT  OF   OR  IN  CONNECTION  WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef __RING_BUF_COBS_H__
+#define __RING_BUF_COBS_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "ring_buf.h"
+
+/*!
+ * \defgroup ring_buf_cobs COBS-Framed Ring Buffer
+ * \brief Zero-delimited frames encoded and decoded in place.
+ * \details Consistent overhead byte stuffing removes every zero from a frame
+ * by splitting it into blocks, each led by a code byte giving the distance to
+ * the next zero. A single zero then delimits each encoded frame. Encoding
+ * costs at most one byte per 254 plus the code and delimiter bytes.
+ *
+ * Puts encode directly into the free spans, so each byte passes once from the
+ * caller's data into the buffer. Gets find the delimiter in place, then
+ * decode block by block from the used spans into the caller's data, again in
+ * one pass. Either side of the wrap works.
+ * \note Do \e not mix framed puts with plain puts. Encoded bytes flowing
+ * through a plain byte stream, e.g. to a UART, remain self-synchronising:
+ * the receiver re-frames at the next zero.
+ * \{
+ */
+
+/*!
+ * \brief Maximum encoded size.
+ * \details Worst-case size of a frame of \p _size_ bytes once encoded,
+ * including its delimiter.
+ * \param _size_ Number of bytes before encoding.
+ */
+#define RING_BUF_COBS_MAX(_size_) ((_size_) + (_size_) / 254U + 2U)
+
+/*!
+ * \brief Puts an encoded frame.
+ * \details Encodes the parts as one frame followed by its delimiter.
+ * \param buf Address of the ring buffer.
+ * \param iov Array of parts to encode, none with \c NULL data.
+ * \param iovcnt Number of parts.
+ * \returns Number of bytes to acknowledge on success, or a negative error
+ * number.
+ * \retval -EMSGSIZE if the buffer has less free space than the worst-case
+ * encoded size.
+ * \note Does \e not auto-acknowledge the put claim.
+ */
+int ring_buf_cobs_putv(struct ring_buf *buf, const struct ring_buf_iovec *iov,
+                       int iovcnt);
+
+/*!
+ * \brief Puts an encoded frame.
+ * \param buf Address of the ring buffer.
+ * \param data Address of bytes to encode.
+ * \param size Number of bytes to encode.
+ * \returns Number of bytes to acknowledge on success, or a negative error
+ * number.
+ * \retval -EMSGSIZE if the buffer has less free space than the worst-case
+ * encoded size.
+ * \note Does \e not auto-acknowledge the put claim.
+ */
+int ring_buf_cobs_put(struct ring_buf *buf, const void *data,
+                      ring_buf_size_t size);
+
+/*!
+ * \brief Gets and decodes the next frame.
+ * \details Claims the encoded frame and its delimiter only on success. On
+ * failure the frame stays put; skip it with \c ring_buf_cobs_skip.
+ * \param buf Address of the ring buffer.
+ * \param data Address of bytes to fill, or \c NULL to discard.
+ * \param size Maximum number of decoded bytes.
+ * \param length Address of the decoded length on success.
+ * \returns Number of bytes to acknowledge on success, or a negative error
+ * number.
+ * \retval -EAGAIN if no complete frame has arrived.
+ * \retval -EBADMSG if the frame is empty or a block overruns it.
+ * \retval -EMSGSIZE if the frame decodes to more than \p size bytes.
+ * \note Does \e not auto-acknowledge the get claim.
+ */
+int ring_buf_cobs_get(struct ring_buf *buf, void *data, ring_buf_size_t size,
+                      ring_buf_size_t *length);
+
+/*!
+ * \brief Skips the next frame.
+ * \details Claims the encoded frame and its delimiter without decoding.
+ * \param buf Address of the ring buffer.
+ * \returns Number of bytes to acknowledge on success, or a negative error
+ * number.
+ * \retval -EAGAIN if no complete frame has arrived.
+ * \note Does \e not auto-acknowledge the get claim.
+ */
+int ring_buf_cobs_skip(struct ring_buf *buf);
+
+/*!
+ * \}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __RING_BUF_COBS_H__ */
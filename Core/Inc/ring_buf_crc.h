@@ -0,0 +1,133 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: 2026, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+/*!
+ * \file ring_buf_crc.h
+ * \brief Ring buffer CRC function prototypes.
+ * \details Declares incremental CRC-32 functions over linear blocks and over
+ * the spans of a ring buffer region, with software and STM32 CRC peripheral
+ * backends.
+ * \copyright 2026, Roy Ratcliffe, Northumberland, United Kingdom
+ *
+ * Permission is hereby granted, free of charge,  to any person obtaining a
+ * copy  of  this  software  and    associated   documentation  files  (the
+ * "Software"), to deal in  the   Software  without  restriction, including
+ * without limitation the rights to  use,   copy,  modify,  merge, publish,
+ * distribute, sublicense, and/or sell  copies  of   the  Software,  and to
+ * permit persons to whom the Software is   furnished  to do so, subject to
+ * the following conditions:
+ *
+ *     The above copyright notice and this permission notice shall be
+ *     included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT  WARRANTY OF ANY KIND, EXPRESS
+ * OR  IMPLIED,  INCLUDING  BUT  NOT   LIMITED    TO   THE   WARRANTIES  OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR   PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS  OR   COPYRIGHT  HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER   IN  AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM,  OUT  OF   OR  IN  CONNECTION  WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef __RING_BUF_CRC_H__
+#define __RING_BUF_CRC_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "ring_buf.h"
+
+#include <stdint.h>
+
+/*!
+ * \defgroup ring_buf_crc Ring Buffer CRC
+ * \brief CRC-32 over ring buffer spans without copying.
+ * \details Computes CRC-32/MPEG-2: polynomial 0x04C11DB7, initial value all
+ * ones, bits most significant first, no final inversion. That is the CRC that
+ * the STM32F4 CRC peripheral computes over big-endian words, so both backends
+ * agree. The check value for the nine ASCII digits "123456789" is 0x0376E6E7.
+ *
+ * The software backend slices by eight: eight 256-entry tables consume eight
+ * bytes per step. The tables are 8 KiB of constants in flash. Define
+ * \c RING_BUF_CRC_HW to compute whole words on the CRC peripheral instead;
+ * any remaining bytes and any unaligned lead-in fall back to software.
+ *
+ * Calculations are incremental. Start from \c RING_BUF_CRC32_INIT and feed
+ * each piece's result into the next.
+ * \note The peripheral has a single state register. Do not compute CRCs with
+ * the hardware backend from more than one execution context at a time.
+ * \{
+ */
+
+/*!
+ * \brief Initial CRC value.
+ */
+#define RING_BUF_CRC32_INIT 0xffffffffU
+
+/*!
+ * \brief Continues a CRC in software.
+ * \param crc CRC so far.
+ * \param data Address of bytes.
+ * \param size Number of bytes.
+ * \returns CRC including the bytes.
+ */
+uint32_t ring_buf_crc32_sw(uint32_t crc, const void *data,
+                           ring_buf_size_t size);
+
+#ifdef RING_BUF_CRC_HW
+/*!
+ * \brief Continues a CRC on the CRC peripheral.
+ * \details Enables the peripheral clock, then loads \p crc into the
+ * peripheral by writing the one word that takes its reset state to \p crc.
+ * \param crc CRC so far.
+ * \param data Address of bytes.
+ * \param size Number of bytes.
+ * \returns CRC including the bytes.
+ */
+uint32_t ring_buf_crc32_hw(uint32_t crc, const void *data,
+                           ring_buf_size_t size);
+#endif
+
+/*!
+ * \brief Continues a CRC.
+ * \details Uses the configured backend.
+ * \param crc CRC so far.
+ * \param data Address of bytes.
+ * \param size Number of bytes.
+ * \returns CRC including the bytes.
+ */
+uint32_t ring_buf_crc32(uint32_t crc, const void *data, ring_buf_size_t size);
+
+/*!
+ * \brief Continues a CRC over a pair of spans.
+ * \param crc CRC so far.
+ * \param spans Array of two spans.
+ * \returns CRC including both spans in order.
+ */
+uint32_t ring_buf_crc32_spans(uint32_t crc,
+                              const struct ring_buf_span spans[2]);
+
+/*!
+ * \brief Computes the CRC of a region of used space.
+ * \details Covers \p size bytes starting \p offset bytes after the get
+ * zone's head, in place, for instance a queued record before getting it.
+ * \param buf Ring buffer.
+ * \param offset Offset of the region.
+ * \param size Number of bytes in the region.
+ * \returns CRC of the region.
+ * \note The region must lie within the used space.
+ */
+uint32_t ring_buf_crc32_used(const struct ring_buf *buf,
+                             ring_buf_size_t offset, ring_buf_size_t size);
+
+/*!
+ * \}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __RING_BUF_CRC_H__ */
@@ -0,0 +1,222 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: 2026, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+/*!
+ * \file ring_buf_dma.h
+ * \brief Asynchronous ring buffer transfer function prototypes.
+ * \details Declares functions that copy between a ring buffer and a linear
+ * block using a transfer engine, typically memory-to-memory DMA, so that the
+ * processor does not wait inside \c memcpy for large puts and gets.
+ * \copyright 2026, Roy Ratcliffe, Northumberland, United Kingdom
+ *
+ * Permission is hereby granted, free of charge,  to any person obtaining a
+ * copy  of  this  software  and    associated   documentation  files  (the
+ * "Software"), to deal in  the   Software  without  restriction, including
+ * without limitation the rights to  use,   copy,  modify,  merge, publish,
+ * distribute, sublicense, and/or sell  copies  of   the  Software,  and to
+ * permit persons to whom the Software is   furnished  to do so, subject to
+ * the following conditions:
+ *
+ *     The above copyright notice and this permission notice shall be
+ *     included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT  WARRANTY OF ANY KIND, EXPRESS
+ * OR  IMPLIED,  INCLUDING  BUT  NOT   LIMITED    TO   THE   WARRANTIES  OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR   PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS  OR   COPYRIGHT  HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER   IN  AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM,  OUT  OF   OR  IN  CONNECTION  WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef __RING_BUF_DMA_H__
+#define __RING_BUF_DMA_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "ring_buf.h"
+
+#include <stdint.h>
+
+/*!
+ * \defgroup ring_buf_dma Asynchronous Ring Buffer Transfers
+ * \brief Puts and gets completed by a transfer engine.
+ * \details A transfer claims contiguous space, hands the copy to the engine
+ * and returns at once. The engine calls \c ring_buf_dma_complete when the
+ * copy finishes, usually from its interrupt handler. Completion acknowledges
+ * the claim, then claims and starts the next contiguous piece until the
+ * requested size is reached or the buffer runs out of space or data. The
+ * transfer's \c done callback finally receives the number of bytes moved.
+ *
+ * Claims and acknowledgements use the single-producer single-consumer
+ * functions, so the other side of the buffer may run concurrently, e.g. the
+ * main loop getting while DMA completes puts. Only one transfer runs at a
+ * time per \c ring_buf_dma.
+ * \note Synchronous engines, such as \c ring_buf_dma_memcpy, complete from
+ * within the start call. The \c done callback then runs before the put or
+ * get returns.
+ * \{
+ */
+
+struct ring_buf_dma;
+
+/*!
+ * \brief Transfer engine operations.
+ */
+struct ring_buf_dma_ops {
+  /*!
+   * \brief Starts copying.
+   * \details Starts copying \p size bytes from \p src to \p dst. The engine
+   * later calls \c ring_buf_dma_complete exactly once for each successful
+   * start.
+   * \param dma Asynchronous transfer, carrying the engine's context.
+   * \param dst Destination address.
+   * \param src Source address.
+   * \param size Number of bytes, never zero and never more than \c max.
+   * \retval 0 if the copy started.
+   * \retval -EBUSY or other negative error number if it did not.
+   */
+  int (*start)(struct ring_buf_dma *dma, void *dst, const void *src,
+               ring_buf_size_t size);
+
+  /*!
+   * \brief Largest single copy.
+   * \details Zero for no limit.
+   */
+  ring_buf_size_t max;
+};
+
+/*!
+ * \brief Transfer state.
+ */
+enum ring_buf_dma_state {
+  RING_BUF_DMA_IDLE,
+  RING_BUF_DMA_PUT,
+  RING_BUF_DMA_GET,
+};
+
+/*!
+ * \brief Asynchronous ring buffer transfer.
+ */
+struct ring_buf_dma {
+  /*!
+   * \brief Ring buffer.
+   */
+  struct ring_buf *const buf;
+
+  /*!
+   * \brief Transfer engine operations.
+   */
+  const struct ring_buf_dma_ops *ops;
+
+  /*!
+   * \brief Transfer engine context.
+   */
+  void *context;
+
+  /*!
+   * \brief Completion callback.
+   * \details Called once per transfer with the number of bytes moved, or a
+   * negative error number if the engine failed; bytes moved before the
+   * failure remain acknowledged. May be \c NULL.
+   */
+  void (*done)(struct ring_buf_dma *dma, int result);
+
+  /*!
+   * \brief Extra data for the completion callback.
+   */
+  void *extra;
+
+  /*!
+   * \brief Transfer state.
+   */
+  volatile enum ring_buf_dma_state state;
+
+  /*!
+   * \brief Linear block, advanced past the bytes moved.
+   */
+  uint8_t *data;
+
+  /*!
+   * \brief Bytes remaining.
+   */
+  ring_buf_size_t size;
+
+  /*!
+   * \brief Bytes in the copy under way.
+   */
+  ring_buf_size_t chunk;
+
+  /*!
+   * \brief Bytes moved so far.
+   */
+  ring_buf_size_t count;
+};
+
+/*!
+ * \brief Software transfer engine.
+ * \details Copies synchronously with \c memcpy. Falls back to the processor
+ * where no DMA stream is free, and on targets without one.
+ */
+extern const struct ring_buf_dma_ops ring_buf_dma_memcpy;
+
+/*!
+ * \brief Starts putting.
+ * \details Copies up to \p size bytes from \p data into the ring buffer. The
+ * block must remain valid until the transfer completes.
+ * \param dma Asynchronous transfer.
+ * \param data Address of bytes to put.
+ * \param size Number of bytes to put.
+ * \retval 0 if the transfer started.
+ * \retval -EBUSY if a transfer is already under way.
+ * \retval -EMSGSIZE if there is no free space; nothing started.
+ * \retval Other negative error numbers from the engine; nothing started.
+ */
+int ring_buf_dma_put(struct ring_buf_dma *dma, const void *data,
+                     ring_buf_size_t size);
+
+/*!
+ * \brief Starts getting.
+ * \details Copies up to \p size bytes out of the ring buffer into \p data.
+ * \param dma Asynchronous transfer.
+ * \param data Address of bytes to get.
+ * \param size Number of bytes to get.
+ * \retval 0 if the transfer started.
+ * \retval -EBUSY if a transfer is already under way.
+ * \retval -EAGAIN if there is no used space; nothing started.
+ * \retval Other negative error numbers from the engine; nothing started.
+ */
+int ring_buf_dma_get(struct ring_buf_dma *dma, void *data,
+                     ring_buf_size_t size);
+
+/*!
+ * \brief Completes one copy.
+ * \details Called by the transfer engine when a started copy finishes or
+ * fails. Acknowledges the copied space and starts the next piece, or ends the
+ * transfer and calls \c done. Ignored when no transfer is under way.
+ * \param dma Asynchronous transfer.
+ * \param err Zero on success, otherwise a negative error number.
+ */
+void ring_buf_dma_complete(struct ring_buf_dma *dma, int err);
+
+/*!
+ * \brief Whether a transfer is under way.
+ * \param dma Asynchronous transfer.
+ * \returns \c true if busy.
+ */
+static inline bool ring_buf_dma_busy(const struct ring_buf_dma *dma) {
+  return dma->state != RING_BUF_DMA_IDLE;
+}
+
+/*!
+ * \}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __RING_BUF_DMA_H__ */
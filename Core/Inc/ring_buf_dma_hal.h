@@ -0,0 +1,83 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: 2026, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+/*!
+ * \file ring_buf_dma_hal.h
+ * \brief HAL DMA transfer engine for asynchronous ring buffer transfers.
+ * \details Declares the memory-to-memory DMA engine for \c ring_buf_dma on
+ * the STM32F4 HAL.
+ * \copyright 2026, Roy Ratcliffe, Northumberland, United Kingdom
+ *
+ * Permission is hereby granted, free of charge,  to any person obtaining a
+ * copy  of  this  software  and    associated   documentation  files  (the
+ * "Software"), to deal in  the   Software  without  restriction, including
+ * without limitation the rights to  use,   copy,  modify,  merge, publish,
+ * distribute, sublicense, and/or sell  copies  of   the  Software,  and to
+ * permit persons to whom the Software is   furnished  to do so, subject to
+ * the following conditions:
+ *
+ *     The above copyright notice and this permission notice shall be
+ *     included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT  WARRANTY OF ANY KIND, EXPRESS
+ * OR  IMPLIED,  INCLUDING  BUT  NOT   LIMITED    TO   THE   WARRANTIES  OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR   PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS  OR   COPYRIGHT  HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER   IN  AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM,  OUT  OF   OR  IN  CONNECTION  WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef __RING_BUF_DMA_HAL_H__
+#define __RING_BUF_DMA_HAL_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "ring_buf_dma.h"
+#include "stm32f4xx_hal.h"
+
+/*!
+ * \defgroup ring_buf_dma_hal HAL DMA Transfer Engine
+ * \brief Memory-to-memory DMA for asynchronous ring buffer transfers.
+ * \details Only DMA2 streams can copy memory to memory on the STM32F4. The
+ * engine copies bytes with the FIFO enabled, as memory-to-memory mode
+ * requires, so neither end needs any particular alignment; at most 65535
+ * bytes go per piece. Route the stream's interrupt handler to
+ * \c HAL_DMA_IRQHandler and enable it in the NVIC.
+ * \note DMA cannot reach the core-coupled memory. Keep the ring buffer space
+ * and the linear blocks in main SRAM.
+ * \{
+ */
+
+/*!
+ * \brief HAL DMA transfer engine.
+ * \details Expects the transfer's context to be the DMA handle.
+ */
+extern const struct ring_buf_dma_ops ring_buf_dma_hal;
+
+/*!
+ * \brief Initialises a DMA2 stream as a transfer engine.
+ * \details Enables the DMA2 clock, configures the handle for byte-wide
+ * memory-to-memory copies on \p instance, initialises it, and attaches the
+ * handle and transfer to each other.
+ * \param dma Asynchronous transfer.
+ * \param hdma DMA handle.
+ * \param instance DMA2 stream, e.g. \c DMA2_Stream0.
+ * \returns HAL status of \c HAL_DMA_Init.
+ */
+HAL_StatusTypeDef ring_buf_dma_hal_init(struct ring_buf_dma *dma,
+                                        DMA_HandleTypeDef *hdma,
+                                        DMA_Stream_TypeDef *instance);
+
+/*!
+ * \}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __RING_BUF_DMA_HAL_H__ */
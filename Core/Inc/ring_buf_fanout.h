@@ -0,0 +1,155 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: 2026, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+/*!
+ * \file ring_buf_fanout.h
+ * \brief Fan-out ring buffer function prototypes.
+ * \details Declares functions for several independent readers of one ring
+ * buffer, for example correlation, logging and level metering of the same
+ * sample stream, without copying the stream once per reader.
+ * \copyright 2026, Roy Ratcliffe, Northumberland, United Kingdom
+ *
+ * Permission is hereby granted, free of charge,  to any person obtaining a
+ * copy  of  this  software  and    associated   documentation  files  (the
+ * "Software"), to deal in  the   Software  without  restriction, including
+ * without limitation the rights to  use,   copy,  modify,  merge, publish,
+ * distribute, sublicense, and/or sell  copies  of   the  Software,  and to
+ * permit persons to whom the Software is   furnished  to do so, subject to
+ * the following conditions:
+ *
+ *     The above copyright notice and this permission notice shall be
+ *     included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT  WARRANTY OF ANY KIND, EXPRESS
+ * OR  IMPLIED,  INCLUDING  BUT  NOT   LIMITED    TO   THE   WARRANTIES  OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR   PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS  OR   COPYRIGHT  HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER   IN  AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM,  OUT  OF   OR  IN  CONNECTION  WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef __RING_BUF_FANOUT_H__
+#define __RING_BUF_FANOUT_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "ring_buf.h"
+
+/*!
+ * \defgroup ring_buf_fanout Fan-Out Ring Buffer
+ * \brief One producer, several independent readers.
+ * \details Every reader has its own get zone over the same buffer space and
+ * sees every byte put. The producer puts with the plain put functions on the
+ * underlying ring buffer. The slowest reader bounds the free space: after
+ * each reader acknowledgement the underlying buffer's own get zone follows
+ * the reader furthest behind, so a put never overwrites bytes that some
+ * reader has yet to get.
+ *
+ * One slow or stalled reader therefore holds up the producer; detach it by
+ * resetting it to the put zone if that matters.
+ * \note Never get directly from the underlying ring buffer. Its get zone
+ * belongs to the fan-out readers.
+ * \{
+ */
+
+/*!
+ * \brief Fan-out ring buffer.
+ */
+struct ring_buf_fanout {
+  /*!
+   * \brief Underlying ring buffer.
+   */
+  struct ring_buf *const buf;
+
+  /*!
+   * \brief Array of reader get zones.
+   */
+  struct ring_buf_zone *const readers;
+
+  /*!
+   * \brief Number of readers.
+   */
+  const int count;
+};
+
+/*!
+ * \brief Defines a static fan-out ring buffer.
+ * \param _name_ Name of the fan-out ring buffer.
+ * \param _size_ Size of the underlying ring buffer.
+ * \param _readers_ Number of readers.
+ */
+#define RING_BUF_FANOUT_DEFINE_STATIC(_name_, _size_, _readers_)               \
+  RING_BUF_DEFINE_STATIC(_name_##_buf, _size_);                                \
+  static struct ring_buf_zone _name_##_readers[_readers_];                     \
+  static struct ring_buf_fanout _name_ = {                                     \
+      .buf = &_name_##_buf, .readers = _name_##_readers, .count = (_readers_)}
+
+/*!
+ * \brief Resets a reader.
+ * \details Moves the reader to the put zone's tail, discarding everything it
+ * has not yet read. A reader joining late starts from here.
+ * \param fanout Fan-out ring buffer.
+ * \param reader Reader index.
+ */
+void ring_buf_fanout_reset(struct ring_buf_fanout *fanout, int reader);
+
+/*!
+ * \brief Used space for one reader.
+ * \param fanout Fan-out ring buffer.
+ * \param reader Reader index.
+ * \returns Number of bytes put but not yet claimed by the reader.
+ */
+ring_buf_size_t ring_buf_fanout_used_space(const struct ring_buf_fanout *fanout,
+                                           int reader);
+
+/*!
+ * \brief Claims contiguous space for one reader.
+ * \param fanout Fan-out ring buffer.
+ * \param reader Reader index.
+ * \param space Address of pointer to claimed space, or \c NULL to ignore.
+ * \param size Number of bytes to claim.
+ * \returns Number of bytes claimed.
+ */
+ring_buf_size_t ring_buf_fanout_get_claim(struct ring_buf_fanout *fanout,
+                                          int reader, void **space,
+                                          ring_buf_size_t size);
+
+/*!
+ * \brief Acknowledges claimed space for one reader.
+ * \details Releases the space to the producer once every other reader has
+ * also acknowledged it.
+ * \param fanout Fan-out ring buffer.
+ * \param reader Reader index.
+ * \param size Number of bytes to acknowledge.
+ * \retval 0 on success.
+ * \retval -EINVAL if \c size exceeds the reader's claimed space.
+ */
+int ring_buf_fanout_get_ack(struct ring_buf_fanout *fanout, int reader,
+                            ring_buf_size_t size);
+
+/*!
+ * \brief Gets all or none for one reader.
+ * \details Copies and acknowledges \p size bytes, or nothing.
+ * \param fanout Fan-out ring buffer.
+ * \param reader Reader index.
+ * \param data Address of bytes to get, or \c NULL to discard.
+ * \param size Number of bytes to get.
+ * \retval 0 on success.
+ * \retval -EAGAIN if the reader has fewer than \p size bytes available.
+ */
+int ring_buf_fanout_get_all(struct ring_buf_fanout *fanout, int reader,
+                            void *data, ring_buf_size_t size);
+
+/*!
+ * \}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __RING_BUF_FANOUT_H__ */
@@ -0,0 +1,103 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: 2026, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+/*!
+ * \file ring_buf_find.h
+ * \brief Ring buffer search function prototypes.
+ * \details Declares functions that search the unread bytes of a ring buffer
+ * in place, for delimiters and multi-byte patterns, across the wrap at the
+ * end of the buffer space.
+ * \copyright 2026, Roy Ratcliffe, Northumberland, United Kingdom
+ *
+ * Permission is hereby granted, free of charge,  to any person obtaining a
+ * copy  of  this  software  and    associated   documentation  files  (the
+ * "Software"), to deal in  the   Software  without  restriction, including
+ * without limitation the rights to  use,   copy,  modify,  merge, publish,
+ * distribute, sublicense, and/or sell  copies  of   the  Software,  and to
+ * permit persons to whom the Software is   furnished  to do so, subject to
+ * the following conditions:
+ *
+ *     The above copyright notice and this permission notice shall be
+ *     included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT  WARRANTY OF ANY KIND, EXPRESS
+ * OR  IMPLIED,  INCLUDING  BUT  NOT   LIMITED    TO   THE   WARRANTIES  OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR   PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS  OR   COPYRIGHT  HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER   IN  AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM,  OUT  OF   OR  IN  CONNECTION  WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef __RING_BUF_FIND_H__
+#define __RING_BUF_FIND_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "ring_buf.h"
+
+#include <stdint.h>
+
+/*!
+ * \defgroup ring_buf_find Ring Buffer Search
+ * \brief Finds delimiters and patterns without copying.
+ * \details Searches cover the used spans, i.e. the bytes that the next get
+ * claim would cover. Offsets count from the start of those bytes, so a
+ * delimiter found at \c offset ends a frame of \c offset plus one bytes,
+ * ready for \c ring_buf_get or \c ring_buf_get_all. A search can resume
+ * from where the last one gave up as more data arrives, e.g.
+ * \code
+ * ring_buf_ptrdiff_t found = ring_buf_find_byte(buf, '\n', scanned);
+ * if (found < 0) {
+ *   scanned = ring_buf_used_space(buf);
+ * } else {
+ *   (void)ring_buf_get_all(buf, line, found + 1);
+ *   scanned = 0;
+ * }
+ * \endcode
+ * \{
+ */
+
+/*!
+ * \brief Finds a byte.
+ * \details Scans a word at a time, four bytes per step, once aligned.
+ * \param buf Ring buffer.
+ * \param byte Byte to find.
+ * \param offset Offset at which to start searching.
+ * \returns Offset of the first matching byte at or after \p offset.
+ * \retval -EAGAIN if no unread byte at or after \p offset matches.
+ */
+ring_buf_ptrdiff_t ring_buf_find_byte(const struct ring_buf *buf, uint8_t byte,
+                                      ring_buf_size_t offset);
+
+/*!
+ * \brief Finds a pattern.
+ * \details Scans for the pattern's first byte as \c ring_buf_find_byte does,
+ * then compares the rest in place, across the wrap if need be.
+ * \param buf Ring buffer.
+ * \param pattern Address of the pattern's bytes.
+ * \param length Number of bytes in the pattern.
+ * \param offset Offset at which to start searching.
+ * \returns Offset of the first byte of the first complete match at or after
+ * \p offset.
+ * \retval -EAGAIN if no complete match exists yet. A partial match at the
+ * end of the unread bytes may complete later, so resume at most \p length
+ * less one bytes before the end.
+ */
+ring_buf_ptrdiff_t ring_buf_find_pattern(const struct ring_buf *buf,
+                                         const void *pattern,
+                                         ring_buf_size_t length,
+                                         ring_buf_size_t offset);
+
+/*!
+ * \}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __RING_BUF_FIND_H__ */
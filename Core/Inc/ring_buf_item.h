@@ -73,6 +73,107 @@ int ring_buf_item_put(struct ring_buf *buf, const void *item,
 int ring_buf_item_get(struct ring_buf *buf, void *item,
                       ring_buf_item_length_t *length);
 
+/*!
+ * \brief Peeks at the length of the next item.
+ * \details Reads the length prefix without claiming it.
+ * \param buf Address of the ring buffer.
+ * \param length Address of the length of the next item on success.
+ * \retval 0 on success.
+ * \retval -EAGAIN if the buffer is empty.
+ */
+int ring_buf_item_peek_length(const struct ring_buf *buf,
+                              ring_buf_item_length_t *length);
+
+/*!
+ * \brief Peeks at the first bytes of the next item.
+ * \details Copies at most \p size leading bytes of the next item without
+ * claiming anything, for example just enough of a header to route the item.
+ * \param buf Address of the ring buffer.
+ * \param data Address of bytes to fill.
+ * \param size Maximum number of bytes to copy.
+ * \returns Number of bytes copied, the lesser of \p size and the item's
+ * length, or a negative error number.
+ * \retval -EAGAIN if the buffer is empty.
+ */
+int ring_buf_item_peek(const struct ring_buf *buf, void *data,
+                       ring_buf_size_t size);
+
+/*!
+ * \brief Skips the next item.
+ * \details Claims the next item's length and content without copying.
+ * \param buf Address of the ring buffer.
+ * \returns Number of bytes to acknowledge on success, or a negative error
+ * number.
+ * \retval -EAGAIN if the buffer is empty.
+ * \note Does \e not auto-acknowledge the get claim.
+ */
+int ring_buf_item_skip(struct ring_buf *buf);
+
+/*!
+ * \brief Yields every queued item in place.
+ * \details Walks the items between the get zone's head and the put zone's
+ * tail without claiming or copying them. The yield function receives each
+ * item as at most two spans, since an item can wrap around the end of the
+ * buffer space, together with its length, a zero-based index and an extra
+ * context pointer.
+ * \param buf Address of the ring buffer.
+ * \param yield Function to call with each item.
+ * \param extra Extra context pointer to pass to the yield function.
+ * \returns The number of yielded items, or the yield result if it is not
+ * \c -EAGAIN.
+ * \retval -EBADMSG if a length prefix runs past the used space, as when the
+ * buffer holds something other than items.
+ * \note The yield function should return \c -EAGAIN to continue yielding, or
+ * any other value to terminate the yielding process.
+ */
+int ring_buf_item_yield(const struct ring_buf *buf,
+                        int yield(const struct ring_buf_span spans[2],
+                                  ring_buf_item_length_t length, int index,
+                                  void *extra),
+                        void *extra);
+
+/*!
+ * \brief Maximum size of a variable-length item length prefix.
+ * \details LEB128 encodes seven bits per byte, so a 32-bit length needs at
+ * most five bytes.
+ */
+#define RING_BUF_ITEM_VARINT_MAX 5U
+
+/*!
+ * \brief Puts an item with a variable-length length prefix.
+ * \details Prefixes the item with its length in unsigned LEB128: one byte for
+ * items shorter than 128 bytes, two for items shorter than 16 KiB, and so on
+ * up to \c RING_BUF_ITEM_VARINT_MAX bytes.
+ * \param buf Address of the ring buffer.
+ * \param item Address of item to put.
+ * \param length Number of bytes to put.
+ * \returns Number of bytes to acknowledge on success, or a negative error
+ * number.
+ * \retval -EMSGSIZE if the buffer has insufficient space to put the item's
+ * length and data, or the length exceeds the buffer size.
+ * \note Does \e not auto-acknowledge the put claim.
+ */
+int ring_buf_item_put_varint(struct ring_buf *buf, const void *item,
+                             uint32_t length);
+
+/*!
+ * \brief Gets an item with a variable-length length prefix.
+ * \param buf Address of the ring buffer.
+ * \param item Address of the item, or \c NULL to discard it.
+ * \param length Address of the length of the item on success.
+ * \returns Number of bytes to acknowledge on success, or a negative error
+ * number.
+ * \retval -EAGAIN if the buffer is empty or holds only part of an item.
+ * \retval -EBADMSG if the length prefix is overlong or gives a length that
+ * could never fit the buffer.
+ * \note Claims nothing unless it succeeds. After \c -EBADMSG, discard used
+ * bytes to resynchronise.
+ * \note Do \e not mix variable-length items with fixed-length items on the
+ * same ring buffer.
+ */
+int ring_buf_item_get_varint(struct ring_buf *buf, void *item,
+                             uint32_t *length);
+
 #ifdef __cplusplus
 }
 #endif
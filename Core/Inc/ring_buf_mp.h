@@ -0,0 +1,153 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: 2026, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+/*!
+ * \file ring_buf_mp.h
+ * \brief Multi-producer ring buffer function prototypes.
+ * \details Declares lock-free functions for several producers, for instance
+ * interrupt service routines at different priorities, putting data into one
+ * ring buffer drained by a single consumer.
+ * \copyright 2026, Roy Ratcliffe, Northumberland, United Kingdom
+ *
+ * Permission is hereby granted, free of charge,  to any person obtaining a
+ * copy  of  this  software  and    associated   documentation  files  (the
+ * "Software"), to deal in  the   Software  without  restriction, including
+ * without limitation the rights to  use,   copy,  modify,  merge, publish,
+ * distribute, sublicense, and/or sell  copies  of   the  Software,  and to
+ * permit persons to whom the Software is   furnished  to do so, subject to
+ * the following conditions:
+ *
+ *     The above copyright notice and this permission notice shall be
+ *     included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT  WARRANTY OF ANY KIND, EXPRESS
+ * OR  IMPLIED,  INCLUDING  BUT  NOT   LIMITED    TO   THE   WARRANTIES  OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR   PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS  OR   COPYRIGHT  HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER   IN  AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM,  OUT  OF   OR  IN  CONNECTION  WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef __RING_BUF_MP_H__
+#define __RING_BUF_MP_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "ring_buf.h"
+
+/*!
+ * \defgroup ring_buf_mp Multi-Producer Ring Buffer
+ * \brief Lock-free puts from several producers.
+ * \details Producers reserve space by advancing the put zone's head with a
+ * compare-and-exchange, i.e. LDREX/STREX on Cortex-M4. Each producer then
+ * copies its data into its own reservation and commits. The put zone's tail
+ * publishes data to the consumer; it only advances when no producer is
+ * between reservation and commit, and then only as far as the head observed
+ * at that point. The consumer therefore never sees a reservation before its
+ * producer has finished writing it, and records appear in reservation order.
+ *
+ * A producer never waits for another. A preempting producer finishes before
+ * the producer it preempted resumes, so nested interrupt handlers cannot
+ * deadlock. Under constant contention, publication can lag until the
+ * producers momentarily drain.
+ *
+ * The single consumer uses the \c ring_buf_spsc_get functions on the
+ * underlying ring buffer.
+ * \note Producers compute offsets from the put zone's base. Publishing
+ * producers move the base forward by whole multiples of the size so that the
+ * offsets stay exact when the indices wrap. Prefer power-of-two sizes, which
+ * take the masked path rather than a division and never move the base.
+ * \{
+ */
+
+/*!
+ * \brief Multi-producer ring buffer.
+ */
+struct ring_buf_mp {
+  /*!
+   * \brief Underlying ring buffer.
+   */
+  struct ring_buf *const buf;
+
+  /*!
+   * \brief Number of producers between reservation and commit.
+   */
+  unsigned writers;
+};
+
+/*!
+ * \brief Defines a static multi-producer ring buffer.
+ * \param _name_ Name of the multi-producer ring buffer.
+ * \param _size_ Size of the underlying ring buffer.
+ */
+#define RING_BUF_MP_DEFINE_STATIC(_name_, _size_)                              \
+  RING_BUF_DEFINE_STATIC(_name_##_buf, _size_);                                \
+  static struct ring_buf_mp _name_ = {.buf = &_name_##_buf}
+
+/*!
+ * \brief Defines a static power-of-two multi-producer ring buffer.
+ * \param _name_ Name of the multi-producer ring buffer.
+ * \param _size_ Size of the underlying ring buffer, a power of two.
+ */
+#define RING_BUF_MP_DEFINE_STATIC_POW2(_name_, _size_)                         \
+  RING_BUF_DEFINE_STATIC_POW2(_name_##_buf, _size_);                           \
+  static struct ring_buf_mp _name_ = {.buf = &_name_##_buf}
+
+/*!
+ * \brief Reserves space for putting.
+ * \details Reserves \p size bytes, all or nothing, and describes the
+ * reservation as at most two spans. The producer writes the spans then calls
+ * \c ring_buf_mp_put_commit, whether or not the reservation succeeded.
+ * \param mp Multi-producer ring buffer.
+ * \param size Number of bytes to reserve.
+ * \param spans Array of two spans to fill.
+ * \retval 0 on success.
+ * \retval -EMSGSIZE if there is insufficient free space.
+ */
+int ring_buf_mp_put_claim(struct ring_buf_mp *mp, ring_buf_size_t size,
+                          struct ring_buf_span spans[2]);
+
+/*!
+ * \brief Commits a reservation.
+ * \details Publishes all committed reservations to the consumer if no other
+ * producer is mid-reservation; otherwise leaves the last one to publish.
+ * \param mp Multi-producer ring buffer.
+ */
+void ring_buf_mp_put_commit(struct ring_buf_mp *mp);
+
+/*!
+ * \brief Puts all parts or none.
+ * \details Reserves, copies and commits the parts as one record.
+ * \param mp Multi-producer ring buffer.
+ * \param iov Array of parts to put.
+ * \param iovcnt Number of parts.
+ * \retval 0 on success.
+ * \retval -EMSGSIZE if the parts together will not fit.
+ */
+int ring_buf_mp_putv(struct ring_buf_mp *mp, const struct ring_buf_iovec *iov,
+                     int iovcnt);
+
+/*!
+ * \brief Puts all or none.
+ * \param mp Multi-producer ring buffer.
+ * \param data Address of bytes to put.
+ * \param size Number of bytes to put.
+ * \retval 0 on success.
+ * \retval -EMSGSIZE if the data will not fit.
+ */
+int ring_buf_mp_put(struct ring_buf_mp *mp, const void *data,
+                    ring_buf_size_t size);
+
+/*!
+ * \}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __RING_BUF_MP_H__ */
@@ -0,0 +1,149 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: 2026, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+/*!
+ * \file ring_buf_spsc.h
+ * \brief Single-producer single-consumer ring buffer function prototypes.
+ * \details Declares lock-free ring buffer functions for one producer and one
+ * consumer running in different execution contexts, e.g. an interrupt service
+ * routine putting data and the main loop getting it.
+ * \copyright 2026, Roy Ratcliffe, Northumberland, United Kingdom
+ *
+ * Permission is hereby granted, free of charge,  to any person obtaining a
+ * copy  of  this  software  and    associated   documentation  files  (the
+ * "Software"), to deal in  the   Software  without  restriction, including
+ * without limitation the rights to  use,   copy,  modify,  merge, publish,
+ * distribute, sublicense, and/or sell  copies  of   the  Software,  and to
+ * permit persons to whom the Software is   furnished  to do so, subject to
+ * the following conditions:
+ *
+ *     The above copyright notice and this permission notice shall be
+ *     included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT  WARRANTY OF ANY KIND, EXPRESS
+ * OR  IMPLIED,  INCLUDING  BUT  NOT   LIMITED    TO   THE   WARRANTIES  OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR   PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS  OR   COPYRIGHT  HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER   IN  AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM,  OUT  OF   OR  IN  CONNECTION  WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef __RING_BUF_SPSC_H__
+#define __RING_BUF_SPSC_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "ring_buf.h"
+
+/*!
+ * \defgroup ring_buf_spsc Single-Producer Single-Consumer Ring Buffer
+ * \brief Lock-free access for one producer and one consumer.
+ * \details The producer only ever writes the put zone and the consumer only
+ * ever writes the get zone. Each side reads the other side's \e tail index,
+ * and only the tail. The put tail publishes data to the consumer; the get tail
+ * publishes free space back to the producer. Loads of the other side's tail
+ * have acquire semantics and stores of the own tail have release semantics,
+ * so the data copied into or out of the claimed space is always visible
+ * before the index that publishes it.
+ *
+ * No critical sections are required. An interrupt service routine can put
+ * while the main loop gets, or vice versa.
+ * \note Do not mix these functions with the plain claim and acknowledge
+ * functions on the same side of the same buffer. The plain functions remain
+ * safe to use when nothing else touches the buffer concurrently.
+ * \{
+ */
+
+/*!
+ * \brief Calculates used space from the consumer side.
+ * \param buf Ring buffer.
+ * \returns Number of used bytes that the consumer can get.
+ */
+ring_buf_size_t ring_buf_spsc_used_space(const struct ring_buf *buf);
+
+/*!
+ * \brief Calculates free space from the producer side.
+ * \param buf Ring buffer.
+ * \returns Number of free bytes that the producer can put.
+ */
+ring_buf_size_t ring_buf_spsc_free_space(const struct ring_buf *buf);
+
+/*!
+ * \brief Claims space for putting data, producer side.
+ * \details Same semantics as \c ring_buf_put_claim, except that the free space
+ * derives from an acquired load of the consumer's get tail.
+ * \param buf Ring buffer address.
+ * \param space Address of pointer to claimed space, or \c NULL to ignore.
+ * \param size Number of bytes to claim.
+ * \returns Number of bytes claimed.
+ */
+ring_buf_size_t ring_buf_spsc_put_claim(struct ring_buf *buf, void **space,
+                                        ring_buf_size_t size);
+
+/*!
+ * \brief Acknowledges put space and publishes it to the consumer.
+ * \param buf Ring buffer address.
+ * \param size Number of bytes to acknowledge.
+ * \retval 0 on successful put.
+ * \retval -EINVAL if \c size exceeds previously claimed aggregate space.
+ */
+int ring_buf_spsc_put_ack(struct ring_buf *buf, ring_buf_size_t size);
+
+/*!
+ * \brief Claims space for getting data, consumer side.
+ * \details Same semantics as \c ring_buf_get_claim, except that the used space
+ * derives from an acquired load of the producer's put tail.
+ * \param buf Ring buffer address.
+ * \param space Address of pointer to claimed space, or \c NULL to ignore.
+ * \param size Number of bytes to claim.
+ * \returns Number of bytes claimed.
+ */
+ring_buf_size_t ring_buf_spsc_get_claim(struct ring_buf *buf, void **space,
+                                        ring_buf_size_t size);
+
+/*!
+ * \brief Acknowledges get space and releases it to the producer.
+ * \param buf Ring buffer address.
+ * \param size Number of bytes to acknowledge.
+ * \retval 0 on successful get.
+ * \retval -EINVAL if \c size exceeds previously claimed aggregate space.
+ */
+int ring_buf_spsc_get_ack(struct ring_buf *buf, ring_buf_size_t size);
+
+/*!
+ * \brief Puts all or none, producer side.
+ * \details Copies the data into one or two claims and publishes them with a
+ * single acknowledgement. The consumer therefore never sees part of the data.
+ * \param buf Ring buffer.
+ * \param data Address of bytes to put.
+ * \param size Number of bytes to put.
+ * \retval 0 on success.
+ * \retval -EMSGSIZE if the data will not fit.
+ */
+int ring_buf_spsc_put_all(struct ring_buf *buf, const void *data,
+                          ring_buf_size_t size);
+
+/*!
+ * \brief Gets all or none, consumer side.
+ * \param buf Ring buffer.
+ * \param data Address of copied data, or \c NULL to discard.
+ * \param size Number of bytes to get.
+ * \retval 0 on success.
+ * \retval -EAGAIN if insufficient data is available.
+ */
+int ring_buf_spsc_get_all(struct ring_buf *buf, void *data,
+                          ring_buf_size_t size);
+
+/*!
+ * \}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __RING_BUF_SPSC_H__ */
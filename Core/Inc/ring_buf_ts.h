@@ -0,0 +1,257 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: 2026, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+/*!
+ * \file ring_buf_ts.h
+ * \brief Timestamped ring buffer record function prototypes.
+ * \details Declares functions for length-prefixed records with timestamps,
+ * and for finding the records within a time range by binary search.
+ * \copyright 2026, Roy Ratcliffe, Northumberland, United Kingdom
+ *
+ * Permission is hereby granted, free of charge,  to any person obtaining a
+ * copy  of  this  software  and    associated   documentation  files  (the
+ * "Software"), to deal in  the   Software  without  restriction, including
+ * without limitation the rights to  use,   copy,  modify,  merge, publish,
+ * distribute, sublicense, and/or sell  copies  of   the  Software,  and to
+ * permit persons to whom the Software is   furnished  to do so, subject to
+ * the following conditions:
+ *
+ *     The above copyright notice and this permission notice shall be
+ *     included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT  WARRANTY OF ANY KIND, EXPRESS
+ * OR  IMPLIED,  INCLUDING  BUT  NOT   LIMITED    TO   THE   WARRANTIES  OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR   PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS  OR   COPYRIGHT  HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER   IN  AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM,  OUT  OF   OR  IN  CONNECTION  WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef __RING_BUF_TS_H__
+#define __RING_BUF_TS_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "ring_buf_item.h"
+#include "ring_buf_type.h"
+
+/*!
+ * \defgroup ring_buf_ts Timestamped Ring Buffer Records
+ * \brief Records with timestamps, searchable by time.
+ * \details Records are plain ring buffer items in one ring buffer. A second
+ * ring buffer holds a fixed-size index entry per record: its timestamp and
+ * the position of its length prefix. Index entries are all the same size, so
+ * the k-th oldest is directly addressable and a binary search over the index
+ * finds the first record at or after a given time in O(log n) steps.
+ *
+ * Timestamps must not decrease from one record to the next. They compare by
+ * signed difference, so a free-running counter may wrap provided that the
+ * buffered records span less than half its range.
+ * \{
+ */
+
+#ifdef RING_BUF_TS_64
+/*!
+ * \brief Timestamp type.
+ * \details 64 bits when \c RING_BUF_TS_64 is defined, otherwise 32.
+ */
+typedef uint64_t ring_buf_ts_t;
+
+/*!
+ * \brief Signed timestamp difference type.
+ */
+typedef int64_t ring_buf_ts_diff_t;
+#else
+typedef uint32_t ring_buf_ts_t;
+typedef int32_t ring_buf_ts_diff_t;
+#endif
+
+/*!
+ * \brief Timestamp index entry.
+ */
+struct ring_buf_ts_entry {
+  /*!
+   * \brief Timestamp of the record.
+   */
+  ring_buf_ts_t ts;
+
+  /*!
+   * \brief Position of the record's length prefix.
+   * \details Put-zone index of the record within the record ring buffer.
+   */
+  ring_buf_ptrdiff_t position;
+};
+
+/*!
+ * \brief Timestamped ring buffer.
+ */
+struct ring_buf_ts {
+  /*!
+   * \brief Record ring buffer.
+   */
+  struct ring_buf *const buf;
+
+  /*!
+   * \brief Index ring buffer of \c ring_buf_ts_entry elements.
+   */
+  struct ring_buf *const index;
+};
+
+/*!
+ * \brief Defines a static timestamped ring buffer.
+ * \param _name_ Name of the timestamped ring buffer.
+ * \param _size_ Size of the record ring buffer in bytes.
+ * \param _records_ Maximum number of records.
+ */
+#define RING_BUF_TS_DEFINE_STATIC(_name_, _size_, _records_)                   \
+  RING_BUF_DEFINE_STATIC(_name_##_buf, _size_);                                \
+  RING_BUF_TYPE_DEFINE_STATIC(_name_##_index, struct ring_buf_ts_entry,        \
+                              _records_);                                      \
+  static struct ring_buf_ts _name_ = {.buf = &_name_##_buf,                    \
+                                      .index = &_name_##_index}
+
+/*!
+ * \brief Current time.
+ * \details Reads the DWT cycle counter on the target, which the application
+ * must enable, or a monotonic clock in nanoseconds on a host. Weak, so that
+ * applications and tests can substitute their own clock. With
+ * \c RING_BUF_TS_64, the target clock extends the 32-bit cycle counter using
+ * \c ring_buf_ts_extend.
+ * \returns Current timestamp.
+ */
+ring_buf_ts_t ring_buf_ts_clock(void);
+
+#ifdef RING_BUF_TS_64
+/*!
+ * \brief Free-running 32-bit counter extended to 64 bits.
+ * \details Each counter carries its own wrap count, so any number of counters
+ * extend independently.
+ */
+struct ring_buf_ts_counter {
+  /*!
+   * \brief Address of the counter, e.g. \c &DWT->CYCCNT.
+   */
+  const volatile uint32_t *const count;
+
+  /*!
+   * \brief Previous reading.
+   */
+  uint32_t last;
+
+  /*!
+   * \brief Number of wraps seen.
+   */
+  uint32_t wraps;
+};
+
+/*!
+ * \brief Extends a free-running 32-bit counter to 64 bits.
+ * \details Reads the counter and counts its wraps in the high word, with
+ * interrupts masked on the target so that every context sees one sequence.
+ * A wrap shows up as a reading below the previous one. Read at least once per
+ * wrap, about every 25 seconds for the cycle counter at 168 MHz, or wraps go
+ * uncounted.
+ * \param counter Counter and its wrap state.
+ * \returns Extended count.
+ */
+ring_buf_ts_t ring_buf_ts_extend(struct ring_buf_ts_counter *counter);
+#endif
+
+/*!
+ * \brief Number of records.
+ * \param ts Timestamped ring buffer.
+ * \returns Number of records held.
+ */
+ring_buf_size_t ring_buf_ts_count(const struct ring_buf_ts *ts);
+
+/*!
+ * \brief Puts a timestamped record.
+ * \details Puts and acknowledges the record and its index entry, or neither.
+ * \param ts Timestamped ring buffer.
+ * \param timestamp Timestamp of the record, no earlier than the newest.
+ * \param data Address of bytes to put.
+ * \param length Number of bytes to put.
+ * \retval 0 on success.
+ * \retval -EMSGSIZE if either the record or its index entry will not fit.
+ */
+int ring_buf_ts_put(struct ring_buf_ts *ts, ring_buf_ts_t timestamp,
+                    const void *data, ring_buf_item_length_t length);
+
+/*!
+ * \brief Puts a timestamped record, dropping the oldest to make room.
+ * \details Suits continuous capture where the latest history matters, e.g.
+ * before and after a trigger.
+ * \param ts Timestamped ring buffer.
+ * \param timestamp Timestamp of the record, no earlier than the newest.
+ * \param data Address of bytes to put.
+ * \param length Number of bytes to put.
+ * \retval 0 on success.
+ * \retval -EMSGSIZE if the record will not fit even in an empty buffer, in
+ * which case it drops nothing.
+ */
+int ring_buf_ts_put_circ(struct ring_buf_ts *ts, ring_buf_ts_t timestamp,
+                         const void *data, ring_buf_item_length_t length);
+
+/*!
+ * \brief Gets the oldest record.
+ * \details Gets and acknowledges the record and its index entry.
+ * \param ts Timestamped ring buffer.
+ * \param timestamp Address of the record's timestamp on success, or \c NULL
+ * to ignore.
+ * \param data Address of the record's bytes, or \c NULL to discard. Reserve
+ * space for the largest possible record.
+ * \param length Address of the record's length on success, or \c NULL to
+ * ignore.
+ * \retval 0 on success.
+ * \retval -EAGAIN if there are no records.
+ */
+int ring_buf_ts_get(struct ring_buf_ts *ts, ring_buf_ts_t *timestamp,
+                    void *data, ring_buf_item_length_t *length);
+
+/*!
+ * \brief Finds the first record at or after a time.
+ * \details Binary searches the index.
+ * \param ts Timestamped ring buffer.
+ * \param timestamp Time to search for.
+ * \returns Zero-based index of the first record, oldest first, whose
+ * timestamp is not earlier than \p timestamp; the number of records if none.
+ */
+ring_buf_size_t ring_buf_ts_lower_bound(const struct ring_buf_ts *ts,
+                                        ring_buf_ts_t timestamp);
+
+/*!
+ * \brief Yields the records within a time range in place.
+ * \details Finds the first record at or after \p t0 by binary search, then
+ * yields records in order until one is at or after \p t1. Neither claims nor
+ * copies. The yield function receives each record as at most two spans.
+ * \param ts Timestamped ring buffer.
+ * \param t0 Start of the range, inclusive.
+ * \param t1 End of the range, exclusive.
+ * \param yield Function to call with each record.
+ * \param extra Extra context pointer to pass to the yield function.
+ * \returns The number of yielded records, or the yield result if it is not
+ * \c -EAGAIN.
+ * \note The yield function should return \c -EAGAIN to continue yielding, or
+ * any other value to terminate the yielding process.
+ */
+int ring_buf_ts_yield(const struct ring_buf_ts *ts, ring_buf_ts_t t0,
+                      ring_buf_ts_t t1,
+                      int yield(const struct ring_buf_span spans[2],
+                                ring_buf_item_length_t length,
+                                ring_buf_ts_t timestamp, int index,
+                                void *extra),
+                      void *extra);
+
+/*!
+ * \}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __RING_BUF_TS_H__ */
@@ -0,0 +1,178 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: 2026, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+/*!
+ * \file ring_buf_type.h
+ * \brief Element-typed ring buffer macros.
+ * \details Generates inline ring buffer functions that count in elements of
+ * one type rather than in bytes.
+ * \copyright 2026, Roy Ratcliffe, Northumberland, United Kingdom
+ *
+ * Permission is hereby granted, free of charge,  to any person obtaining a
+ * copy  of  this  software  and    associated   documentation  files  (the
+ * "Software"), to deal in  the   Software  without  restriction, including
+ * without limitation the rights to  use,   copy,  modify,  merge, publish,
+ * distribute, sublicense, and/or sell  copies  of   the  Software,  and to
+ * permit persons to whom the Software is   furnished  to do so, subject to
+ * the following conditions:
+ *
+ *     The above copyright notice and this permission notice shall be
+ *     included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT  WARRANTY OF ANY KIND, EXPRESS
+ * OR  IMPLIED,  INCLUDING  BUT  NOT   LIMITED    TO   THE   WARRANTIES  OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR   PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS  OR   COPYRIGHT  HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER   IN  AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM,  OUT  OF   OR  IN  CONNECTION  WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef __RING_BUF_TYPE_H__
+#define __RING_BUF_TYPE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "ring_buf.h"
+
+/*!
+ * \defgroup ring_buf_type Element-Typed Ring Buffer
+ * \brief Claims, acknowledgements and counts in elements.
+ * \details \c RING_BUF_TYPE_DEFINE generates a family of static inline
+ * functions for one element type, each a thin wrapper around the byte-wise
+ * function of the same name. Element sizes are compile-time constants, so
+ * the conversions between elements and bytes fold into shifts or constant
+ * multiplies.
+ *
+ * Elements stay whole and aligned provided that the buffer space is aligned
+ * for the element type and its size is a whole number of elements, and that
+ * every put and get on the buffer goes through the typed functions. Claims
+ * then clamp at element boundaries because every size they clamp against is
+ * a multiple of the element size. \c RING_BUF_TYPE_DEFINE_STATIC and
+ * \c RING_BUF_TYPE_DEFINE_STATIC_POW2 allocate such buffers.
+ *
+ * For example, the following defines \c ring_buf_f32_put, \c ring_buf_f32_get
+ * and friends for 32-bit floats, then a buffer of 256 floats:
+ * \code
+ * RING_BUF_TYPE_DEFINE(ring_buf_f32, float32_t)
+ * RING_BUF_TYPE_DEFINE_STATIC(samples, float32_t, 256);
+ * \endcode
+ * \{
+ */
+
+/*!
+ * \brief Defines a static ring buffer of elements.
+ * \details Fails to compile if the size in bytes exceeds
+ * \c RING_BUF_SIZE_MAX.
+ * \param _name_ Name of the ring buffer.
+ * \param _type_ Element type.
+ * \param _count_ Number of elements.
+ */
+#define RING_BUF_TYPE_DEFINE_STATIC(_name_, _type_, _count_)                   \
+  _Static_assert(sizeof(_type_[_count_]) <= RING_BUF_SIZE_MAX,                 \
+                 "ring buffer size exceeds RING_BUF_SIZE_MAX");                \
+  static _type_ _ring_buf_space_##_name_[_count_];                             \
+  static struct ring_buf _name_ = {.space = _ring_buf_space_##_name_,          \
+                                   .size = sizeof(_type_[_count_])}
+
+/*!
+ * \brief Defines a static power-of-two ring buffer of elements.
+ * \details The element size times the count must be a power of two, as it is
+ * whenever both are. Fails to compile if the size is not a power of two or
+ * exceeds \c RING_BUF_SIZE_MAX.
+ * \param _name_ Name of the ring buffer.
+ * \param _type_ Element type.
+ * \param _count_ Number of elements.
+ */
+#define RING_BUF_TYPE_DEFINE_STATIC_POW2(_name_, _type_, _count_)              \
+  _Static_assert(sizeof(_type_[_count_]) <= RING_BUF_SIZE_MAX,                 \
+                 "ring buffer size exceeds RING_BUF_SIZE_MAX");                \
+  _Static_assert(sizeof(_type_[_count_]) != 0 &&                               \
+                     (sizeof(_type_[_count_]) &                                \
+                      (sizeof(_type_[_count_]) - 1)) == 0,                     \
+                 "ring buffer size must be a power of two");                   \
+  static _type_ _ring_buf_space_##_name_[_count_];                             \
+  static struct ring_buf _name_ = {.space = _ring_buf_space_##_name_,          \
+                                   .size = sizeof(_type_[_count_]),            \
+                                   .mask = sizeof(_type_[_count_]) - 1}
+
+/*!
+ * \brief Defines element-typed ring buffer functions.
+ * \details Defines the following static inline functions, where \c T is the
+ * element type and all counts are in elements:
+ * - \c _prefix_##_used_space and \c _prefix_##_free_space
+ * - \c _prefix_##_put_claim and \c _prefix_##_get_claim, taking \c T** space
+ * - \c _prefix_##_put_ack and \c _prefix_##_get_ack
+ * - \c _prefix_##_put and \c _prefix_##_get, answering elements to acknowledge
+ * - \c _prefix_##_put_all and \c _prefix_##_get_all, all or none
+ * - \c _prefix_##_window_spans, with span sizes still in bytes
+ * - \c _prefix_##_at, where index -1 is the newest element
+ * \param _prefix_ Function name prefix, e.g. \c ring_buf_f32.
+ * \param _type_ Element type.
+ */
+#define RING_BUF_TYPE_DEFINE(_prefix_, _type_)                                 \
+  static inline ring_buf_size_t _prefix_##_used_space(                         \
+      const struct ring_buf *buf) {                                            \
+    return ring_buf_used_space(buf) / sizeof(_type_);                          \
+  }                                                                            \
+  static inline ring_buf_size_t _prefix_##_free_space(                         \
+      const struct ring_buf *buf) {                                            \
+    return ring_buf_free_space(buf) / sizeof(_type_);                          \
+  }                                                                            \
+  static inline ring_buf_size_t _prefix_##_put_claim(                          \
+      struct ring_buf *buf, _type_ **space, ring_buf_size_t count) {           \
+    return ring_buf_put_claim(buf, (void **)space, count * sizeof(_type_)) /   \
+           sizeof(_type_);                                                     \
+  }                                                                            \
+  static inline int _prefix_##_put_ack(struct ring_buf *buf,                   \
+                                       ring_buf_size_t count) {                \
+    return ring_buf_put_ack(buf, count * sizeof(_type_));                      \
+  }                                                                            \
+  static inline ring_buf_size_t _prefix_##_get_claim(                          \
+      struct ring_buf *buf, _type_ **space, ring_buf_size_t count) {           \
+    return ring_buf_get_claim(buf, (void **)space, count * sizeof(_type_)) /   \
+           sizeof(_type_);                                                     \
+  }                                                                            \
+  static inline int _prefix_##_get_ack(struct ring_buf *buf,                   \
+                                       ring_buf_size_t count) {                \
+    return ring_buf_get_ack(buf, count * sizeof(_type_));                      \
+  }                                                                            \
+  static inline ring_buf_size_t _prefix_##_put(                                \
+      struct ring_buf *buf, const _type_ *data, ring_buf_size_t count) {       \
+    return ring_buf_put(buf, data, count * sizeof(_type_)) / sizeof(_type_);   \
+  }                                                                            \
+  static inline ring_buf_size_t _prefix_##_get(                                \
+      struct ring_buf *buf, _type_ *data, ring_buf_size_t count) {             \
+    return ring_buf_get(buf, data, count * sizeof(_type_)) / sizeof(_type_);   \
+  }                                                                            \
+  static inline int _prefix_##_put_all(                                        \
+      struct ring_buf *buf, const _type_ *data, ring_buf_size_t count) {       \
+    return ring_buf_put_all(buf, data, count * sizeof(_type_));                \
+  }                                                                            \
+  static inline int _prefix_##_get_all(struct ring_buf *buf, _type_ *data,     \
+                                       ring_buf_size_t count) {                \
+    return ring_buf_get_all(buf, data, count * sizeof(_type_));                \
+  }                                                                            \
+  static inline ring_buf_size_t _prefix_##_window_spans(                       \
+      const struct ring_buf *buf, ring_buf_size_t count,                       \
+      struct ring_buf_span spans[2]) {                                         \
+    return ring_buf_window_spans(buf, count * sizeof(_type_), spans) /         \
+           sizeof(_type_);                                                     \
+  }                                                                            \
+  static inline _type_ *_prefix_##_at(const struct ring_buf *buf,              \
+                                      ring_buf_ptrdiff_t index) {              \
+    return ring_buf_at(buf, index * (ring_buf_ptrdiff_t)sizeof(_type_));       \
+  }
+
+/*!
+ * \}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __RING_BUF_TYPE_H__ */
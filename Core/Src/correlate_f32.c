@@ -9,48 +9,256 @@
 #include "fepsiloneq.h"
 #include "ring_buf.h"
 #include "ring_buf_circ.h"
+#include "ring_buf_type.h"
 
 #include <errno.h>
+#include <stddef.h>
+#include <string.h>
+
+/*
+ * Float-typed ring buffer functions, counting in elements rather than bytes.
+ */
+RING_BUF_TYPE_DEFINE(ring_buf_f32, float32_t)
+
+/*!
+ * \brief Contiguous run of float32_t elements in place.
+ */
+struct correlate_span_f32 {
+  const float32_t *data;
+  size_t len;
+};
+
+/*!
+ * \brief Spans of used float32_t data in a ring buffer, in elements.
+ * \param buf Ring buffer.
+ * \param spans Array of two spans to fill, oldest first.
+ */
+static void correlate_spans_f32(const struct ring_buf *buf, struct correlate_span_f32 spans[2]);
+
+/*!
+ * \brief Dot product across two pairs of spans.
+ * \details Splits the elements into runs contiguous in both pairs and sums one
+ * CMSIS-DSP dot product per run, at most three.
+ * \param x First pair of spans.
+ * \param x_at Index of the first element in the first pair.
+ * \param y Second pair of spans.
+ * \param y_at Index of the first element in the second pair.
+ * \param len Number of elements.
+ * \returns Dot product, zero if \p len is zero.
+ */
+static float32_t correlate_spans_dot_f32(const struct correlate_span_f32 x[2], size_t x_at,
+                                         const struct correlate_span_f32 y[2], size_t y_at,
+                                         size_t len);
 
 /*!
  * \brief Get used float32_t data from ring buffer.
  * \details Retrieves all used data from the ring buffer as float32_t elements.
  * \param buf Ring buffer.
- * \param data Destination array for retrieved data.
+ * \param data Destination array for retrieved data, or NULL to count the
+ * elements without copying them.
  * \returns Number of float32_t elements retrieved.
  */
 static size_t ring_buf_get_used_f32(struct ring_buf *buf, float32_t *data);
 
+/*!
+ * \brief Update running lag sums for a new expected sample.
+ * \details The running lag sum for lag L is the sum of expected[n + L] *
+ * actual[n] over the actual indices n, oldest first, whose expected index is
+ * in range. Sums live at index L plus the actual capacity less one.
+ * \param correlate Correlate 32-bit float instance with running lag sums.
+ * \param expected New expected sample, not yet put.
+ */
+static void correlate_stream_expected_f32(struct correlate_f32 *correlate, float32_t expected);
+
+/*!
+ * \brief Update running lag sums for a new actual sample.
+ * \details Indexes the sums by lag the same way as
+ * correlate_stream_expected_f32().
+ * \param correlate Correlate 32-bit float instance with running lag sums.
+ * \param actual New actual sample, not yet put.
+ */
+static void correlate_stream_actual_f32(struct correlate_f32 *correlate, float32_t actual);
+
+/*!
+ * \brief Add a block sample by sample.
+ * \details Skips samples that the buffer would evict before the block ends;
+ * they leave no trace in the running lag sums.
+ * \param correlate Correlate 32-bit float instance with running lag sums.
+ * \param buf Expected or actual ring buffer, matching \p add.
+ * \param add Function adding one expected or actual sample.
+ * \param data Samples to add.
+ * \param len Number of samples.
+ * \returns 0 on success, negative error code on failure.
+ */
+static int correlate_add_stream_block_f32(struct correlate_f32 *correlate,
+                                          const struct ring_buf *buf,
+                                          int (*add)(struct correlate_f32 *, float32_t),
+                                          const float32_t *data, size_t len);
+
 int correlate_add_expected_f32(struct correlate_f32 *correlate, float32_t expected) {
+  if (correlate->sums != NULL) {
+    correlate_stream_expected_f32(correlate, expected);
+  }
   return ring_buf_put_circ(correlate->buf_expected, &expected, sizeof(expected));
 }
 
 int correlate_add_actual_f32(struct correlate_f32 *correlate, float32_t actual) {
+  if (correlate->sums != NULL) {
+    correlate_stream_actual_f32(correlate, actual);
+  }
   return ring_buf_put_circ(correlate->buf_actual, &actual, sizeof(actual));
 }
 
+int correlate_add_expected_block_f32(struct correlate_f32 *correlate, const float32_t *expected,
+                                     size_t len) {
+  if (correlate->sums != NULL) {
+    return correlate_add_stream_block_f32(correlate, correlate->buf_expected,
+                                          correlate_add_expected_f32, expected, len);
+  }
+  return ring_buf_put_circ_bulk(correlate->buf_expected, expected, len * sizeof(*expected));
+}
+
+int correlate_add_actual_block_f32(struct correlate_f32 *correlate, const float32_t *actual,
+                                   size_t len) {
+  if (correlate->sums != NULL) {
+    return correlate_add_stream_block_f32(correlate, correlate->buf_actual,
+                                          correlate_add_actual_f32, actual, len);
+  }
+  return ring_buf_put_circ_bulk(correlate->buf_actual, actual, len * sizeof(*actual));
+}
+
+/*!
+ * \brief Load the used expected and actual data.
+ * \details Gets used data from the expected and actual ring buffers into the
+ * correlate instance's expected and actual data arrays.
+ *
+ * This is necessary because arm_correlate_f32() operates on contiguous arrays,
+ * whereas the ring buffers overate in discontinuous memory space and may have
+ * wrapped around the end of the buffer. At most there will be two memory copies
+ * per buffer. That makes two, three or four memory copy operations in total
+ * depending on whether each buffer is contiguous or not. Instances without
+ * linear copies only count the elements.
+ * \param correlate Correlate 32-bit float instance.
+ * \retval 0 on success.
+ * \retval -EINVAL if there is no expected or actual data.
+ */
+static int correlate_load_f32(struct correlate_f32 *correlate);
+
+/*!
+ * \brief Count the expected and actual elements without copying them.
+ * \details Sets the lengths as correlate_load_f32() does.
+ * \param correlate Correlate 32-bit float instance.
+ * \retval 0 on success.
+ * \retval -EINVAL if there is no expected or actual data.
+ */
+static int correlate_count_f32(struct correlate_f32 *correlate);
+
+/*!
+ * \brief FFT length for the loaded data.
+ * \param correlate Correlate 32-bit float instance, already loaded.
+ * \returns FFT length, or zero if the scratch space cannot hold the transforms.
+ */
+static size_t correlate_fft_len_f32(const struct correlate_f32 *correlate);
+
+/*!
+ * \brief Correlate the loaded data directly.
+ * \param correlate Correlate 32-bit float instance, already loaded.
+ */
+static void correlate_direct_run_f32(struct correlate_f32 *correlate);
+
+/*!
+ * \brief Correlate the loaded data by FFT.
+ * \param correlate Correlate 32-bit float instance, already loaded.
+ * \param fft_len Transform length from correlate_fft_len_f32().
+ */
+static void correlate_fft_run_f32(struct correlate_f32 *correlate, size_t fft_len);
+
+/*!
+ * \brief Whether FFT correlation costs less than direct correlation.
+ * \param correlate Correlate 32-bit float instance, already loaded.
+ * \param fft_len Transform length from correlate_fft_len_f32().
+ * \returns True if the direct multiply-accumulates outnumber the weighted
+ * transform cost.
+ */
+static bool correlate_fft_cheaper_f32(const struct correlate_f32 *correlate, size_t fft_len);
+
+/*!
+ * \brief Lay out the running lag sums as correlated data.
+ * \param correlate Correlate 32-bit float instance, already counted.
+ */
+static void correlate_stream_run_f32(struct correlate_f32 *correlate);
+
 int correlate_f32(struct correlate_f32 *correlate) {
+  if (correlate->sums != NULL) {
+    return correlate_stream_f32(correlate);
+  }
+  const int err = correlate_load_f32(correlate);
+  if (err < 0) {
+    return err;
+  }
+  const size_t fft_len = correlate_fft_len_f32(correlate);
+  if (fft_len != 0U && correlate_fft_cheaper_f32(correlate, fft_len)) {
+    correlate_fft_run_f32(correlate, fft_len);
+  } else {
+    correlate_direct_run_f32(correlate);
+  }
+  return 0;
+}
+
+int correlate_direct_f32(struct correlate_f32 *correlate) {
+  const int err = correlate_load_f32(correlate);
+  if (err < 0) {
+    return err;
+  }
+  correlate_direct_run_f32(correlate);
+  return 0;
+}
+
+int correlate_fft_f32(struct correlate_f32 *correlate) {
+  const int err = correlate_load_f32(correlate);
+  if (err < 0) {
+    return err;
+  }
+  const size_t fft_len = correlate_fft_len_f32(correlate);
+  if (fft_len == 0U) {
+    return -ENOMEM;
+  }
+  correlate_fft_run_f32(correlate, fft_len);
+  return 0;
+}
+
+int correlate_stream_f32(struct correlate_f32 *correlate) {
+  if (correlate->sums == NULL) {
+    return -ENOMEM;
+  }
+  const int err = correlate_count_f32(correlate);
+  if (err < 0) {
+    return err;
+  }
+  correlate_stream_run_f32(correlate);
+  return 0;
+}
+
+int correlate_stream_sync_f32(struct correlate_f32 *correlate) {
+  if (correlate->sums == NULL) {
+    return -ENOMEM;
+  }
+  const size_t actual_size = correlate->buf_actual->size / sizeof(float32_t);
+  const size_t expected_size = correlate->buf_expected->size / sizeof(float32_t);
+  arm_fill_f32(0.0F, correlate->sums, expected_size + actual_size - 1U);
+  if (correlate_load_f32(correlate) < 0) {
+    return 0;
+  }
   /*
-   * Get used data from the expected and actual ring buffers into the correlate
-   * instance's expected and actual data arrays.
-   *
-   * This is necessary because arm_correlate_f32() operates on contiguous
-   * arrays, whereas the ring buffers overate in discontinuous memory space and
-   * may have wrapped around the end of the buffer. At most there will be two
-   * memory copies per buffer. That makes two, three or four memory copy
-   * operations in total depending on whether each buffer is contiguous or not.
+   * Correlate directly then copy the lags back out of the correlated layout.
    */
-  const size_t expected_len = ring_buf_get_used_f32(correlate->buf_expected, correlate->expected);
-  const size_t actual_len = ring_buf_get_used_f32(correlate->buf_actual, correlate->actual);
-  correlate->expected_len = expected_len;
-  correlate->actual_len = actual_len;
-  if (actual_len == 0U || expected_len == 0U) {
-    correlate->correlated_len = 0U;
-    return -EINVAL;
-  }
-  arm_correlate_f32(correlate->expected, expected_len, correlate->actual, actual_len,
-                    correlate->correlated);
-  correlate->correlated_len = expected_len + actual_len - 1U;
+  correlate_direct_run_f32(correlate);
+  const size_t expected_len = correlate->expected_len;
+  const size_t actual_len = correlate->actual_len;
+  const size_t zero_lag = (expected_len > actual_len ? expected_len : actual_len) - 1U;
+  arm_copy_f32(correlate->correlated + zero_lag - (actual_len - 1U),
+               correlate->sums + actual_size - 1U - (actual_len - 1U),
+               expected_len + actual_len - 1U);
   return 0;
 }
 
@@ -130,9 +338,21 @@ int correlate_normalise_f32(struct correlate_f32 *correlate) {
    * expected^2, actual_dot = sum actual^2 using CMSIS-DSP for dot product
    * calculation, i.e. the sum of the squares of the elements.
    */
-  arm_dot_prod_f32(correlate->expected, correlate->expected, correlate->expected_len,
-                   &expected_dot);
-  arm_dot_prod_f32(correlate->actual, correlate->actual, correlate->actual_len, &actual_dot);
+  if (correlate->expected != NULL) {
+    arm_dot_prod_f32(correlate->expected, correlate->expected, correlate->expected_len,
+                     &expected_dot);
+  } else {
+    struct correlate_span_f32 spans[2];
+    correlate_spans_f32(correlate->buf_expected, spans);
+    expected_dot = correlate_spans_dot_f32(spans, 0U, spans, 0U, correlate->expected_len);
+  }
+  if (correlate->actual != NULL) {
+    arm_dot_prod_f32(correlate->actual, correlate->actual, correlate->actual_len, &actual_dot);
+  } else {
+    struct correlate_span_f32 spans[2];
+    correlate_spans_f32(correlate->buf_actual, spans);
+    actual_dot = correlate_spans_dot_f32(spans, 0U, spans, 0U, correlate->actual_len);
+  }
   float32_t denom = sqrtf(expected_dot * actual_dot);
   /*
    * Only normalise if denom is not too small to avoid division by zero.
@@ -153,7 +373,298 @@ static size_t ring_buf_get_used_f32(struct ring_buf *buf, float32_t *data) {
    * This involves one or two memory copies depending on whether the used
    * space is contiguous or wraps around the end of the buffer.
    */
-  size_t len = ring_buf_get(buf, data, ring_buf_used_space(buf)) / sizeof(float32_t);
+  size_t len = ring_buf_f32_get(buf, data, ring_buf_f32_used_space(buf));
   (void)ring_buf_get_ack(buf, 0U);
   return len;
 }
+
+static int correlate_load_f32(struct correlate_f32 *correlate) {
+  const size_t expected_len = ring_buf_get_used_f32(correlate->buf_expected, correlate->expected);
+  const size_t actual_len = ring_buf_get_used_f32(correlate->buf_actual, correlate->actual);
+  correlate->expected_len = expected_len;
+  correlate->actual_len = actual_len;
+  if (actual_len == 0U || expected_len == 0U) {
+    correlate->correlated_len = 0U;
+    return -EINVAL;
+  }
+  return 0;
+}
+
+static int correlate_count_f32(struct correlate_f32 *correlate) {
+  const size_t expected_len = ring_buf_f32_used_space(correlate->buf_expected);
+  const size_t actual_len = ring_buf_f32_used_space(correlate->buf_actual);
+  correlate->expected_len = expected_len;
+  correlate->actual_len = actual_len;
+  if (actual_len == 0U || expected_len == 0U) {
+    correlate->correlated_len = 0U;
+    return -EINVAL;
+  }
+  return 0;
+}
+
+static size_t correlate_fft_len_f32(const struct correlate_f32 *correlate) {
+  const size_t len = correlate->expected_len + correlate->actual_len - 1U;
+  if (correlate->scratch == NULL || len > CORRELATE_F32_FFT_LEN_MAX) {
+    return 0U;
+  }
+  const size_t fft_len = CORRELATE_F32_FFT_LEN(len);
+  return 3U * fft_len <= correlate->scratch_len ? fft_len : 0U;
+}
+
+static bool correlate_fft_cheaper_f32(const struct correlate_f32 *correlate, size_t fft_len) {
+  size_t log2_len = 0U;
+  for (size_t len = fft_len; len > 1U; len >>= 1) {
+    log2_len++;
+  }
+  return correlate->expected_len * correlate->actual_len >
+         CORRELATE_F32_FFT_COST * fft_len * log2_len;
+}
+
+static void correlate_direct_run_f32(struct correlate_f32 *correlate) {
+  if (correlate->expected != NULL && correlate->actual != NULL) {
+    arm_correlate_f32(correlate->expected, correlate->expected_len, correlate->actual,
+                      correlate->actual_len, correlate->correlated);
+    correlate->correlated_len = correlate->expected_len + correlate->actual_len - 1U;
+    return;
+  }
+  /*
+   * Without linear copies, correlate in place. For each lag, the overlapping
+   * actual indices split into at most three runs, contiguous in both buffers,
+   * at the points where either buffer wraps. Lay out the lags as
+   * arm_correlate_f32() does.
+   */
+  struct correlate_span_f32 expected[2], actual[2];
+  correlate_spans_f32(correlate->buf_expected, expected);
+  correlate_spans_f32(correlate->buf_actual, actual);
+  const size_t expected_len = correlate->expected_len;
+  const size_t actual_len = correlate->actual_len;
+  const size_t zero_lag = (expected_len > actual_len ? expected_len : actual_len) - 1U;
+  for (size_t k = 0; k < expected_len + actual_len - 1U; k++) {
+    /*
+     * Index k holds lag k - (actual_len - 1), summing expected[n + lag] *
+     * actual[n] for n from first up to but excluding last.
+     */
+    const size_t first = k < actual_len - 1U ? actual_len - 1U - k : 0U;
+    const size_t last = k < expected_len ? actual_len : expected_len + actual_len - 1U - k;
+    correlate->correlated[zero_lag + k - (actual_len - 1U)] = correlate_spans_dot_f32(
+        expected, first + k - (actual_len - 1U), actual, first, last - first);
+  }
+  correlate->correlated_len = expected_len + actual_len - 1U;
+}
+
+static void correlate_fft_run_f32(struct correlate_f32 *correlate, size_t fft_len) {
+  const size_t expected_len = correlate->expected_len;
+  const size_t actual_len = correlate->actual_len;
+  arm_rfft_fast_instance_f32 rfft;
+  if (arm_rfft_fast_init_f32(&rfft, (uint16_t)fft_len) != ARM_MATH_SUCCESS) {
+    correlate_direct_run_f32(correlate);
+    return;
+  }
+  /*
+   * Three transform-length blocks: padded input, which the transform
+   * overwrites, and the expected and actual spectra. The padded input block
+   * then takes the spectral product; the expected block takes the result.
+   */
+  float32_t *const padded = correlate->scratch;
+  float32_t *const expected = padded + fft_len;
+  float32_t *const actual = expected + fft_len;
+  struct ring_buf_span spans[2];
+  (void)ring_buf_used_spans(correlate->buf_expected, spans);
+  ring_buf_span_read(spans, 0U, padded, expected_len * sizeof(float32_t));
+  arm_fill_f32(0.0F, padded + expected_len, fft_len - expected_len);
+  arm_rfft_fast_f32(&rfft, padded, expected, 0U);
+  (void)ring_buf_used_spans(correlate->buf_actual, spans);
+  ring_buf_span_read(spans, 0U, padded, actual_len * sizeof(float32_t));
+  arm_fill_f32(0.0F, padded + actual_len, fft_len - actual_len);
+  arm_rfft_fast_f32(&rfft, padded, actual, 0U);
+
+  /*
+   * Multiply the expected spectrum by the conjugate of the actual spectrum.
+   * The packed real-transform format puts the purely real DC and Nyquist
+   * terms first, followed by complex pairs for the remaining positive bins.
+   */
+  padded[0] = expected[0] * actual[0];
+  padded[1] = expected[1] * actual[1];
+  arm_cmplx_conj_f32(actual + 2, actual + 2, fft_len / 2U - 1U);
+  arm_cmplx_mult_cmplx_f32(expected + 2, actual + 2, padded + 2, fft_len / 2U - 1U);
+  arm_rfft_fast_f32(&rfft, padded, expected, 1U);
+
+  /*
+   * The inverse transform leaves the circular correlation, sum of
+   * expected[n + lag] * actual[n], with non-negative lags from the start and
+   * negative lags wrapped around to the end. Lay it out exactly as
+   * arm_correlate_f32() does: lag zero at the longer length less one, the
+   * most negative lag first. As with the direct mode, longer expected data
+   * leaves the leading elements unwritten.
+   */
+  const size_t zero_lag = (expected_len > actual_len ? expected_len : actual_len) - 1U;
+  arm_copy_f32(expected + fft_len - (actual_len - 1U),
+               correlate->correlated + zero_lag - (actual_len - 1U), actual_len - 1U);
+  arm_copy_f32(expected, correlate->correlated + zero_lag, expected_len);
+  correlate->correlated_len = expected_len + actual_len - 1U;
+}
+
+/*!
+ * \brief Multiply-accumulate ring buffer elements into running lag sums.
+ * \details Adds \p scale times each used element of \p buf, oldest first, to
+ * the sums starting at index \p at and stepping by \p step. Works on the
+ * buffer's spans in place.
+ * \param sums Running lag sums.
+ * \param at Index of the first sum.
+ * \param step Plus or minus one.
+ * \param scale Multiplier.
+ * \param buf Ring buffer of float32_t elements.
+ */
+static void correlate_stream_mac_f32(float32_t *sums, ptrdiff_t at, ptrdiff_t step,
+                                     float32_t scale, const struct ring_buf *buf) {
+  struct ring_buf_span spans[2];
+  (void)ring_buf_used_spans(buf, spans);
+  for (size_t i = 0; i < 2U; i++) {
+    const float32_t *data = spans[i].space;
+    const size_t len = spans[i].size / sizeof(float32_t);
+    for (size_t n = 0; n < len; n++, at += step) {
+      sums[at] += scale * data[n];
+    }
+  }
+}
+
+/*!
+ * \brief Oldest used element of a ring buffer.
+ * \param buf Ring buffer of float32_t elements, not empty.
+ * \returns Oldest element.
+ */
+static float32_t correlate_stream_oldest_f32(const struct ring_buf *buf) {
+  struct ring_buf_span spans[2];
+  (void)ring_buf_used_spans(buf, spans);
+  return *(const float32_t *)spans[0].space;
+}
+
+static void correlate_stream_expected_f32(struct correlate_f32 *correlate, float32_t expected) {
+  float32_t *const sums = correlate->sums;
+  const size_t actual_size = correlate->buf_actual->size / sizeof(float32_t);
+  const size_t len = correlate->buf_expected->size / sizeof(float32_t) + actual_size - 1U;
+  const ptrdiff_t zero_lag = (ptrdiff_t)actual_size - 1;
+  size_t expected_len = ring_buf_f32_used_space(correlate->buf_expected);
+  if (ring_buf_is_full(correlate->buf_expected)) {
+    /*
+     * Retire the oldest expected sample: subtract its products, at lag -n for
+     * actual[n], then renumber the expected samples down by one, moving every
+     * sum down one lag.
+     */
+    const float32_t oldest = correlate_stream_oldest_f32(correlate->buf_expected);
+    correlate_stream_mac_f32(sums, zero_lag, -1, -oldest, correlate->buf_actual);
+    (void)memmove(sums, sums + 1, (len - 1U) * sizeof(*sums));
+    sums[len - 1U] = 0.0F;
+    expected_len--;
+  }
+  /*
+   * The new sample takes the next expected index, adding to lag that index
+   * less n for each actual[n].
+   */
+  correlate_stream_mac_f32(sums, zero_lag + (ptrdiff_t)expected_len, -1, expected,
+                           correlate->buf_actual);
+}
+
+static void correlate_stream_actual_f32(struct correlate_f32 *correlate, float32_t actual) {
+  float32_t *const sums = correlate->sums;
+  const size_t actual_size = correlate->buf_actual->size / sizeof(float32_t);
+  const size_t len = correlate->buf_expected->size / sizeof(float32_t) + actual_size - 1U;
+  const ptrdiff_t zero_lag = (ptrdiff_t)actual_size - 1;
+  size_t actual_len = ring_buf_f32_used_space(correlate->buf_actual);
+  if (ring_buf_is_full(correlate->buf_actual)) {
+    /*
+     * Retire the oldest actual sample: subtract its products, at lag i for
+     * expected[i], then renumber the actual samples down by one, moving every
+     * sum up one lag.
+     */
+    const float32_t oldest = correlate_stream_oldest_f32(correlate->buf_actual);
+    correlate_stream_mac_f32(sums, zero_lag, 1, -oldest, correlate->buf_expected);
+    (void)memmove(sums + 1, sums, (len - 1U) * sizeof(*sums));
+    sums[0] = 0.0F;
+    actual_len--;
+  }
+  /*
+   * The new sample takes the next actual index, adding to lag i less that
+   * index for each expected[i].
+   */
+  correlate_stream_mac_f32(sums, zero_lag - (ptrdiff_t)actual_len, 1, actual,
+                           correlate->buf_expected);
+}
+
+static int correlate_add_stream_block_f32(struct correlate_f32 *correlate,
+                                          const struct ring_buf *buf,
+                                          int (*add)(struct correlate_f32 *, float32_t),
+                                          const float32_t *data, size_t len) {
+  const size_t size = buf->size / sizeof(float32_t);
+  if (len > size) {
+    data += len - size;
+    len = size;
+  }
+  for (size_t n = 0; n < len; n++) {
+    const int err = add(correlate, data[n]);
+    if (err < 0) {
+      return err;
+    }
+  }
+  return 0;
+}
+
+static void correlate_stream_run_f32(struct correlate_f32 *correlate) {
+  const size_t expected_len = correlate->expected_len;
+  const size_t actual_len = correlate->actual_len;
+  const size_t actual_size = correlate->buf_actual->size / sizeof(float32_t);
+  const size_t zero_lag = (expected_len > actual_len ? expected_len : actual_len) - 1U;
+  arm_copy_f32(correlate->sums + actual_size - 1U - (actual_len - 1U),
+               correlate->correlated + zero_lag - (actual_len - 1U),
+               expected_len + actual_len - 1U);
+  correlate->correlated_len = expected_len + actual_len - 1U;
+}
+
+static void correlate_spans_f32(const struct ring_buf *buf, struct correlate_span_f32 spans[2]) {
+  struct ring_buf_span used[2];
+  (void)ring_buf_used_spans(buf, used);
+  for (size_t i = 0; i < 2U; i++) {
+    spans[i].data = used[i].space;
+    spans[i].len = used[i].size / sizeof(float32_t);
+  }
+}
+
+/*!
+ * \brief Contiguous run at an element index within a pair of spans.
+ * \param spans Pair of spans.
+ * \param at Element index, within the pair.
+ * \param len Pointer to store the number of contiguous elements from the index.
+ * \returns Address of the element.
+ */
+static const float32_t *correlate_spans_at_f32(const struct correlate_span_f32 spans[2], size_t at,
+                                               size_t *len) {
+  if (at < spans[0].len) {
+    *len = spans[0].len - at;
+    return spans[0].data + at;
+  }
+  at -= spans[0].len;
+  *len = spans[1].len - at;
+  return spans[1].data + at;
+}
+
+static float32_t correlate_spans_dot_f32(const struct correlate_span_f32 x[2], size_t x_at,
+                                         const struct correlate_span_f32 y[2], size_t y_at,
+                                         size_t len) {
+  float32_t dot = 0.0F;
+  while (len != 0U) {
+    size_t x_len, y_len;
+    const float32_t *x_data = correlate_spans_at_f32(x, x_at, &x_len);
+    const float32_t *y_data = correlate_spans_at_f32(y, y_at, &y_len);
+    size_t run = x_len < y_len ? x_len : y_len;
+    if (run > len) {
+      run = len;
+    }
+    float32_t part;
+    arm_dot_prod_f32(x_data, y_data, run, &part);
+    dot += part;
+    x_at += run;
+    y_at += run;
+    len -= run;
+  }
+  return dot;
+}
@@ -33,8 +33,28 @@
 
 #include "ring_buf.h"
 
+#include <stdint.h>
 #include <string.h>
 
+/*
+ * Stop the compiler from recognising the copy loops below as a memory copy
+ * idiom and replacing them with a call to the very memcpy() they avoid.
+ */
+#if defined(__clang__)
+#define RING_BUF_NO_MEMCPY_IDIOM __attribute__((__no_builtin__("memcpy")))
+#elif defined(__GNUC__)
+#define RING_BUF_NO_MEMCPY_IDIOM                                               \
+  __attribute__((__optimize__("no-tree-loop-distribute-patterns")))
+#else
+#define RING_BUF_NO_MEMCPY_IDIOM
+#endif
+
+/*!
+ * \brief Word type for bulk copies.
+ * \details May alias any other type, the same as a character type.
+ */
+typedef uint32_t __attribute__((__may_alias__)) ring_buf_word_t;
+
 /*!
  * \brief Clamp a value to a specified limit.
  * \details Clamps the value pointed to by \p clamp to \p limit if it exceeds
@@ -48,6 +68,38 @@ static inline void ring_buf_clamp(ring_buf_size_t *clamp,
     *clamp = limit;
 }
 
+RING_BUF_NO_MEMCPY_IDIOM
+void ring_buf_copy(void *dst, const void *src, ring_buf_size_t size) {
+  uint8_t *d = dst;
+  const uint8_t *s = src;
+  if ((((uintptr_t)d ^ (uintptr_t)s) & (sizeof(ring_buf_word_t) - 1U)) != 0U) {
+    (void)memcpy(d, s, size);
+    return;
+  }
+  if (size >= sizeof(ring_buf_word_t)) {
+    while (((uintptr_t)d & (sizeof(ring_buf_word_t) - 1U)) != 0U) {
+      *d++ = *s++;
+      size--;
+    }
+    ring_buf_word_t *dw = (ring_buf_word_t *)d;
+    const ring_buf_word_t *sw = (const ring_buf_word_t *)s;
+    for (; size >= 4U * sizeof(*dw); size -= 4U * sizeof(*dw)) {
+      dw[0] = sw[0];
+      dw[1] = sw[1];
+      dw[2] = sw[2];
+      dw[3] = sw[3];
+      dw += 4;
+      sw += 4;
+    }
+    for (; size >= sizeof(*dw); size -= sizeof(*dw))
+      *dw++ = *sw++;
+    d = (uint8_t *)dw;
+    s = (const uint8_t *)sw;
+  }
+  while (size--)
+    *d++ = *s++;
+}
+
 /*!
  * \brief Head index of a zone.
  * \details Used as the wrap size when claiming. The wrap size equals the head
@@ -77,7 +129,7 @@ ring_buf_zone_tail(const struct ring_buf_zone *zone) {
  * \return Claim size.
  */
 static inline ring_buf_size_t
-ring_buf_zone_claim(const struct ring_buf_zone *zone) {
+ring_buf_zone_claimed(const struct ring_buf_zone *zone) {
   return zone->head - zone->tail;
 }
 
@@ -93,60 +145,118 @@ static inline void ring_buf_zone_reset(struct ring_buf_zone *zone,
   zone->base = zone->head = zone->tail = base;
 }
 
+/*!
+ * \brief Offset of a zone's head within the buffer space.
+ * \details Rebases the head when it has reached the end of the buffer space.
+ * Power-of-two buffers mask the head instead of comparing and rebasing.
+ * \param buf Ring buffer.
+ * \param zone Ring buffer zone, put or get.
+ * \return Head offset, less than the buffer size.
+ */
+static inline ring_buf_size_t
+ring_buf_zone_head_offset(const struct ring_buf *buf,
+                          const struct ring_buf_zone *zone) {
+  ring_buf_size_t head = ring_buf_zone_head(zone);
+  if (buf->mask)
+    return head & buf->mask;
+  if (head >= buf->size)
+    head -= buf->size;
+  return head;
+}
+
+/*!
+ * \brief Rebases a zone after acknowledging.
+ * \details Keeps the tail within one buffer size of the base. Power-of-two
+ * buffers recompute the base without branching.
+ * \param buf Ring buffer.
+ * \param zone Ring buffer zone, put or get.
+ */
+static inline void ring_buf_zone_rebase(const struct ring_buf *buf,
+                                        struct ring_buf_zone *zone) {
+  if (buf->mask)
+    zone->base = zone->tail - (ring_buf_zone_tail(zone) & buf->mask);
+  else if (ring_buf_zone_tail(zone) >= buf->size)
+    zone->base += buf->size;
+}
+
 void ring_buf_reset(struct ring_buf *buf, ring_buf_ptrdiff_t base) {
   ring_buf_zone_reset(&buf->put, base);
   ring_buf_zone_reset(&buf->get, base);
 }
 
-ring_buf_size_t ring_buf_put_claim(struct ring_buf *buf, void **space,
-                                   ring_buf_size_t size) {
-  ring_buf_ptrdiff_t base = buf->put.base;
-  ring_buf_size_t head = ring_buf_zone_head(&buf->put);
-  if (head >= buf->size) {
-    base += buf->size;
-    head -= buf->size;
-  }
+ring_buf_size_t ring_buf_zone_claim(const struct ring_buf *buf,
+                                    struct ring_buf_zone *zone, void **space,
+                                    ring_buf_size_t size,
+                                    ring_buf_size_t limit) {
+  ring_buf_size_t head = ring_buf_zone_head_offset(buf, zone);
   ring_buf_clamp(&size, buf->size - head);
-  ring_buf_clamp(&size, ring_buf_free_space(buf));
+  ring_buf_clamp(&size, limit);
   if (space)
-    *space = (uint8_t *)buf->space + (buf->put.head - base);
-  buf->put.head += size;
+    *space = (uint8_t *)buf->space + head;
+  zone->head += size;
   return size;
 }
 
-int ring_buf_put_ack(struct ring_buf *buf, ring_buf_size_t size) {
-  ring_buf_size_t claim = ring_buf_zone_claim(&buf->put);
+int ring_buf_zone_ack(const struct ring_buf *buf, struct ring_buf_zone *zone,
+                      ring_buf_size_t size) {
+  ring_buf_size_t claim = ring_buf_zone_claimed(zone);
   if (size > claim)
     return -EINVAL;
-  buf->put.head = (buf->put.tail += size);
-  if (ring_buf_zone_tail(&buf->put) >= buf->size)
-    buf->put.base += buf->size;
+  zone->head = (zone->tail += size);
+  ring_buf_zone_rebase(buf, zone);
+  return 0;
+}
+
+ring_buf_size_t ring_buf_put_claim(struct ring_buf *buf, void **space,
+                                   ring_buf_size_t size) {
+  const ring_buf_size_t claim = ring_buf_zone_claim(
+      buf, &buf->put, space, size, ring_buf_free_space(buf));
+  RING_BUF_STATS_ADD(buf, short_claims, claim < size);
+  return claim;
+}
+
+#ifdef RING_BUF_WATERMARK
+void ring_buf_watermark_notify(struct ring_buf *buf, ring_buf_size_t before) {
+  const struct ring_buf_watermark *watermark = buf->watermark;
+  if (!watermark)
+    return;
+  const ring_buf_size_t after = buf->put.tail - buf->get.tail;
+  if (watermark->rise && before < watermark->high && after >= watermark->high)
+    watermark->rise(buf, watermark->extra);
+  if (watermark->fall && before > watermark->low && after <= watermark->low)
+    watermark->fall(buf, watermark->extra);
+}
+#endif
+
+int ring_buf_put_ack(struct ring_buf *buf, ring_buf_size_t size) {
+  const ring_buf_size_t before = buf->put.tail - buf->get.tail;
+  int err = ring_buf_zone_ack(buf, &buf->put, size);
+  if (err < 0)
+    return err;
+#ifdef RING_BUF_STATS
+  buf->stats.put += size;
+  if (buf->stats.high_water < before + size)
+    buf->stats.high_water = before + size;
+#endif
+  RING_BUF_WATERMARK_NOTIFY(buf, before);
   return 0;
 }
 
 ring_buf_size_t ring_buf_get_claim(struct ring_buf *buf, void **space,
                                    ring_buf_size_t size) {
-  ring_buf_ptrdiff_t base = buf->get.base;
-  ring_buf_size_t head = ring_buf_zone_head(&buf->get);
-  if (head >= buf->size) {
-    base += buf->size;
-    head -= buf->size;
-  }
-  ring_buf_clamp(&size, buf->size - head);
-  ring_buf_clamp(&size, ring_buf_used_space(buf));
-  if (space)
-    *space = (uint8_t *)buf->space + (buf->get.head - base);
-  buf->get.head += size;
-  return size;
+  const ring_buf_size_t claim = ring_buf_zone_claim(
+      buf, &buf->get, space, size, ring_buf_used_space(buf));
+  RING_BUF_STATS_ADD(buf, short_claims, claim < size);
+  return claim;
 }
 
 int ring_buf_get_ack(struct ring_buf *buf, ring_buf_size_t size) {
-  ring_buf_size_t claim = ring_buf_zone_claim(&buf->get);
-  if (size > claim)
-    return -EINVAL;
-  buf->get.head = (buf->get.tail += size);
-  if (ring_buf_zone_tail(&buf->get) >= buf->size)
-    buf->get.base += buf->size;
+  const ring_buf_size_t before = buf->put.tail - buf->get.tail;
+  int err = ring_buf_zone_ack(buf, &buf->get, size);
+  if (err < 0)
+    return err;
+  RING_BUF_STATS_ADD(buf, got, size);
+  RING_BUF_WATERMARK_NOTIFY(buf, before);
   return 0;
 }
 
@@ -156,8 +266,10 @@ ring_buf_size_t ring_buf_put(struct ring_buf *buf, const void *data,
   do {
     void *space;
     claim = ring_buf_put_claim(buf, &space, size);
-    (void)memcpy(space, data, claim);
-    *(const uint8_t **)&data += claim;
+    if (data) {
+      ring_buf_copy(space, data, claim);
+      *(const uint8_t **)&data += claim;
+    }
     ack += claim;
   } while (claim && (size -= claim));
   return ack;
@@ -170,7 +282,7 @@ ring_buf_size_t ring_buf_get(struct ring_buf *buf, void *data,
     void *space;
     claim = ring_buf_get_claim(buf, &space, size);
     if (data) {
-      (void)memcpy(data, space, claim);
+      ring_buf_copy(data, space, claim);
       *(uint8_t **)&data += claim;
     }
     ack += claim;
@@ -182,8 +294,10 @@ int ring_buf_put_all(struct ring_buf *buf, const void *data,
                      ring_buf_size_t size) {
   ring_buf_size_t ack = ring_buf_put(buf, data, size);
   int err = ack < size ? -EMSGSIZE : 0;
-  if (err < 0)
+  if (err < 0) {
+    RING_BUF_STATS_ADD(buf, rejects, 1U);
     ack = 0U;
+  }
   (void)ring_buf_put_ack(buf, ack);
   return err;
 }
@@ -196,3 +310,163 @@ int ring_buf_get_all(struct ring_buf *buf, void *data, ring_buf_size_t size) {
   (void)ring_buf_get_ack(buf, ack);
   return err;
 }
+
+/*!
+ * \brief Splits a region into spans.
+ * \param buf Ring buffer.
+ * \param offset Offset of the region's first byte within the buffer space.
+ * \param size Number of bytes in the region.
+ * \param spans Array of two spans to fill.
+ * \returns Number of bytes in the region.
+ */
+static ring_buf_size_t ring_buf_spans(const struct ring_buf *buf,
+                                      ring_buf_size_t offset,
+                                      ring_buf_size_t size,
+                                      struct ring_buf_span spans[2]) {
+  ring_buf_size_t first = size;
+  ring_buf_clamp(&first, buf->size - offset);
+  spans[0].space = (uint8_t *)buf->space + offset;
+  spans[0].size = first;
+  spans[1].space = buf->space;
+  spans[1].size = size - first;
+  return size;
+}
+
+ring_buf_size_t ring_buf_used_spans(const struct ring_buf *buf,
+                                    struct ring_buf_span spans[2]) {
+  return ring_buf_spans(buf, ring_buf_zone_head_offset(buf, &buf->get),
+                        ring_buf_used_space(buf), spans);
+}
+
+ring_buf_size_t ring_buf_free_spans(const struct ring_buf *buf,
+                                    struct ring_buf_span spans[2]) {
+  return ring_buf_spans(buf, ring_buf_zone_head_offset(buf, &buf->put),
+                        ring_buf_free_space(buf), spans);
+}
+
+void ring_buf_span_slice(const struct ring_buf_span spans[2],
+                         ring_buf_size_t offset, ring_buf_size_t size,
+                         struct ring_buf_span slice[2]) {
+  if (offset >= spans[0].size) {
+    slice[0].space = (uint8_t *)spans[1].space + (offset - spans[0].size);
+    slice[0].size = size;
+    slice[1].space = spans[1].space;
+    slice[1].size = 0U;
+    return;
+  }
+  ring_buf_size_t first = spans[0].size - offset;
+  ring_buf_clamp(&first, size);
+  slice[0].space = (uint8_t *)spans[0].space + offset;
+  slice[0].size = first;
+  slice[1].space = spans[1].space;
+  slice[1].size = size - first;
+}
+
+void ring_buf_span_read(const struct ring_buf_span spans[2],
+                        ring_buf_size_t offset, void *data,
+                        ring_buf_size_t size) {
+  struct ring_buf_span slice[2];
+  ring_buf_span_slice(spans, offset, size, slice);
+  ring_buf_copy(data, slice[0].space, slice[0].size);
+  ring_buf_copy((uint8_t *)data + slice[0].size, slice[1].space, slice[1].size);
+}
+
+/*!
+ * \brief Offset of a byte before the put zone's tail.
+ * \param buf Ring buffer.
+ * \param back Number of bytes back from the tail, at most the buffer size.
+ * \returns Offset of the byte within the buffer space.
+ */
+static inline ring_buf_size_t
+ring_buf_tail_back_offset(const struct ring_buf *buf, ring_buf_size_t back) {
+  ring_buf_size_t tail = ring_buf_zone_tail(&buf->put);
+  if (buf->mask)
+    return (tail - back) & buf->mask;
+  if (tail >= buf->size)
+    tail -= buf->size;
+  if (back > tail)
+    tail += buf->size;
+  return tail - back;
+}
+
+ring_buf_size_t ring_buf_window_spans(const struct ring_buf *buf,
+                                      ring_buf_size_t size,
+                                      struct ring_buf_span spans[2]) {
+  ring_buf_clamp(&size, buf->put.tail - buf->get.tail);
+  return ring_buf_spans(buf, ring_buf_tail_back_offset(buf, size), size, spans);
+}
+
+void *ring_buf_at(const struct ring_buf *buf, ring_buf_ptrdiff_t offset) {
+  const ring_buf_size_t held = buf->put.tail - buf->get.tail;
+  if (offset >= 0 || (ring_buf_size_t)-offset > held)
+    return NULL;
+  return (uint8_t *)buf->space + ring_buf_tail_back_offset(buf, -offset);
+}
+
+/*!
+ * \brief Total size of an I/O vector.
+ * \param iov Array of parts.
+ * \param iovcnt Number of parts.
+ * \returns Sum of the sizes of all parts.
+ */
+static ring_buf_size_t ring_buf_iovec_size(const struct ring_buf_iovec *iov,
+                                           int iovcnt) {
+  ring_buf_size_t size = 0U;
+  for (int i = 0; i < iovcnt; i++)
+    size += iov[i].size;
+  return size;
+}
+
+void ring_buf_iovec_copy(struct ring_buf_span spans[2],
+                         const struct ring_buf_iovec *iov, int iovcnt,
+                         bool put) {
+  struct ring_buf_span *span = spans;
+  for (int i = 0; i < iovcnt; i++) {
+    uint8_t *data = iov[i].data;
+    ring_buf_size_t size = iov[i].size;
+    while (size) {
+      if (span->size == 0U)
+        span++;
+      ring_buf_size_t copy = size;
+      ring_buf_clamp(&copy, span->size);
+      if (data) {
+        if (put)
+          ring_buf_copy(span->space, data, copy);
+        else
+          ring_buf_copy(data, span->space, copy);
+        data += copy;
+      }
+      span->space = (uint8_t *)span->space + copy;
+      span->size -= copy;
+      size -= copy;
+    }
+  }
+}
+
+int ring_buf_putv(struct ring_buf *buf, const struct ring_buf_iovec *iov,
+                  int iovcnt) {
+  const ring_buf_size_t size = ring_buf_iovec_size(iov, iovcnt);
+  if (size > ring_buf_free_space(buf)) {
+    RING_BUF_STATS_ADD(buf, rejects, 1U);
+    return -EMSGSIZE;
+  }
+  struct ring_buf_span spans[2];
+  spans[0].size = ring_buf_put_claim(buf, &spans[0].space, size);
+  spans[1].size =
+      ring_buf_put_claim(buf, &spans[1].space, size - spans[0].size);
+  ring_buf_iovec_copy(spans, iov, iovcnt, true);
+  return size;
+}
+
+int ring_buf_getv(struct ring_buf *buf, const struct ring_buf_iovec *iov,
+                  int iovcnt) {
+  const ring_buf_size_t size = ring_buf_iovec_size(iov, iovcnt);
+  if (size > ring_buf_used_space(buf))
+    return -EAGAIN;
+  struct ring_buf_span spans[2];
+  spans[0].size = ring_buf_get_claim(buf, &spans[0].space, size);
+  spans[1].size =
+      ring_buf_get_claim(buf, &spans[1].space, size - spans[0].size);
+  ring_buf_iovec_copy(spans, iov, iovcnt, false);
+  return size;
+}
@@ -0,0 +1,146 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: 2026, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+/*!
+ * \file ring_buf_bip.c
+ * \brief Bip-buffer ring buffer item functions.
+ * \details Implements contiguous length-prefixed items with skip markers.
+ * \copyright 2026, Roy Ratcliffe, Northumberland, United Kingdom
+ *
+ * Permission is hereby granted, free of charge,  to any person obtaining a
+ * copy  of  this  software  and    associated   documentation  files  (the
+ * "Software"), to deal in  the   Software  without  restriction, including
+ * without limitation the rights to  use,   copy,  modify,  merge, publish,
+ * distribute, sublicense, and/or sell  copies  of   the  Software,  and to
+ * permit persons to whom the Software is   furnished  to do so, subject to
+ * the following conditions:
+ *
+ *     The above copyright notice and this permission notice shall be
+ *     included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT  WARRANTY OF ANY KIND, EXPRESS
+ * OR  IMPLIED,  INCLUDING  BUT  NOT   LIMITED    TO   THE   WARRANTIES  OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR   PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS  OR   COPYRIGHT  HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER   IN  AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM,  OUT  OF   OR  IN  CONNECTION  WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "ring_buf_bip.h"
+
+#include <stdint.h>
+#include <string.h>
+
+/*!
+ * \brief Contiguous bytes from a zone's head to the end of the buffer space.
+ * \details A zero-size claim answers the head's address without moving it.
+ * \param buf Ring buffer.
+ * \param zone Zone, put or get.
+ * \param space Address of pointer to the head's address.
+ * \returns Number of bytes before the end of the buffer space.
+ */
+static ring_buf_size_t ring_buf_bip_contiguous(struct ring_buf *buf,
+                                               struct ring_buf_zone *zone,
+                                               void **space) {
+  (void)ring_buf_zone_claim(buf, zone, space, 0U, 0U);
+  const ring_buf_size_t offset = (uint8_t *)*space - (uint8_t *)buf->space;
+  return buf->size - offset;
+}
+
+/*!
+ * \brief Reserves a contiguous item.
+ * \details Skips to the start of the buffer space if the length prefix and
+ * item do not fit before the end, writing a skip marker if there is room for
+ * one. Claims the prefix and item and writes the prefix.
+ * \param buf Ring buffer.
+ * \param length Item length.
+ * \param item Address of pointer to the item's first byte.
+ * \returns Number of bytes claimed including any skip, or \c -EMSGSIZE.
+ */
+static int ring_buf_bip_reserve(struct ring_buf *buf,
+                                ring_buf_item_length_t length, void **item) {
+  if (length == RING_BUF_BIP_SKIP)
+    return -EMSGSIZE;
+  const ring_buf_size_t size = sizeof(length) + length;
+  void *space;
+  ring_buf_size_t skip = ring_buf_bip_contiguous(buf, &buf->put, &space);
+  if (skip >= size)
+    skip = 0U;
+  if (skip + size > ring_buf_free_space(buf))
+    return -EMSGSIZE;
+  if (skip) {
+    if (skip >= sizeof(length)) {
+      const ring_buf_item_length_t marker = RING_BUF_BIP_SKIP;
+      (void)memcpy(space, &marker, sizeof(marker));
+    }
+    (void)ring_buf_put_claim(buf, NULL, skip);
+  }
+  (void)ring_buf_put_claim(buf, &space, size);
+  (void)memcpy(space, &length, sizeof(length));
+  *item = (uint8_t *)space + sizeof(length);
+  return skip + size;
+}
+
+int ring_buf_bip_put(struct ring_buf *buf, const void *item,
+                     ring_buf_item_length_t length) {
+  void *space;
+  const int ack = ring_buf_bip_reserve(buf, length, &space);
+  if (ack < 0)
+    return ack;
+  (void)memcpy(space, item, length);
+  return ack;
+}
+
+int ring_buf_bip_put_claim(struct ring_buf *buf, ring_buf_item_length_t length,
+                           void **item) {
+  const int ack = ring_buf_bip_reserve(buf, length, item);
+  return ack < 0 ? ack : 0;
+}
+
+int ring_buf_bip_put_commit(struct ring_buf *buf,
+                            ring_buf_item_length_t length) {
+  /*
+   * Find the claimed prefix again from the put zone's tail, exactly as a get
+   * claim would from the get zone's head. The prefix still holds the claimed
+   * maximum length, which never equals the skip marker.
+   */
+  struct ring_buf_zone zone = buf->put;
+  zone.head = zone.tail;
+  void *space;
+  ring_buf_size_t skip = ring_buf_bip_contiguous(buf, &zone, &space);
+  ring_buf_item_length_t claimed = RING_BUF_BIP_SKIP;
+  if (skip >= sizeof(claimed))
+    (void)memcpy(&claimed, space, sizeof(claimed));
+  if (claimed == RING_BUF_BIP_SKIP) {
+    (void)ring_buf_zone_claim(buf, &zone, NULL, skip, skip);
+    (void)ring_buf_bip_contiguous(buf, &zone, &space);
+    (void)memcpy(&claimed, space, sizeof(claimed));
+  } else
+    skip = 0U;
+  const ring_buf_size_t ack = skip + sizeof(length) + length;
+  if (length > claimed ||
+      ack > (ring_buf_size_t)(buf->put.head - buf->put.tail))
+    return -EINVAL;
+  (void)memcpy(space, &length, sizeof(length));
+  return ring_buf_put_ack(buf, ack);
+}
+
+int ring_buf_bip_get_claim(struct ring_buf *buf, void **item,
+                           ring_buf_item_length_t *length) {
+  if (ring_buf_is_empty(buf))
+    return -EAGAIN;
+  void *space;
+  ring_buf_size_t skip = ring_buf_bip_contiguous(buf, &buf->get, &space);
+  if (skip >= sizeof(*length)) {
+    (void)memcpy(length, space, sizeof(*length));
+    if (*length != RING_BUF_BIP_SKIP)
+      skip = 0U;
+  }
+  if (skip)
+    (void)ring_buf_get_claim(buf, NULL, skip);
+  (void)ring_buf_get_claim(buf, &space, sizeof(*length));
+  (void)memcpy(length, space, sizeof(*length));
+  return skip + sizeof(*length) + ring_buf_get_claim(buf, item, *length);
+}
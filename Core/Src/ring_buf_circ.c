@@ -40,9 +40,37 @@
  * data size.
  */
 int ring_buf_put_circ(struct ring_buf *buf, void *data, size_t size) {
-  if (ring_buf_is_full(buf))
-    (void)ring_buf_get_ack(buf, ring_buf_get(buf, NULL, size));
-  if (size > ring_buf_free_space(buf))
+  if (ring_buf_is_full(buf)) {
+    const ring_buf_size_t drop = ring_buf_get(buf, NULL, size);
+    RING_BUF_STATS_ADD(buf, drops, drop);
+    (void)ring_buf_get_ack(buf, drop);
+  }
+  if (size > ring_buf_free_space(buf)) {
+    RING_BUF_STATS_ADD(buf, rejects, 1U);
     return -EMSGSIZE;
+  }
+  return ring_buf_put_ack(buf, ring_buf_put(buf, data, size));
+}
+
+int ring_buf_put_circ_bulk(struct ring_buf *buf, const void *data,
+                           size_t size) {
+  /*
+   * Keep only the newest bytes of an oversized block.
+   */
+  if (size > buf->size) {
+    RING_BUF_STATS_ADD(buf, drops, size - buf->size);
+    data = (const char *)data + (size - buf->size);
+    size = buf->size;
+  }
+  const ring_buf_size_t free_space = ring_buf_free_space(buf);
+  if (size > free_space) {
+    const ring_buf_size_t drop = ring_buf_get(buf, NULL, size - free_space);
+    RING_BUF_STATS_ADD(buf, drops, drop);
+    (void)ring_buf_get_ack(buf, drop);
+  }
+  if (size > ring_buf_free_space(buf)) {
+    RING_BUF_STATS_ADD(buf, rejects, 1U);
+    return -EMSGSIZE;
+  }
   return ring_buf_put_ack(buf, ring_buf_put(buf, data, size));
 }
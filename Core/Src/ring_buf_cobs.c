@@ -0,0 +1,207 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: 2026, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+/*!
+ * \file ring_buf_cobs.c
+ * \brief COBS-framed ring buffer functions.
+ * \details Implements consistent overhead byte stuffing directly on ring
+ * buffer spans.
+ * \copyright 2026, Roy Ratcliffe, Northumberland, United Kingdom
+ *
+ * Permission is hereby granted, free of charge,  to any person obtaining a
+ * copy  of  this  software  and    associated   documentation  files  (the
+ * "Software"), to deal in  the   Software  without  restriction, including
+ * without limitation the rights to  use,   copy,  modify,  merge, publish,
+ * distribute, sublicense, and/or sell  copies  of   the  Software,  and to
+ * permit persons to whom the Software is   furnished  to do so, subject to
+ * the following conditions:
+ *
+ *     The above copyright notice and this permission notice shall be
+ *     included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT  WARRANTY OF ANY KIND, EXPRESS
+ * OR  IMPLIED,  INCLUDING  BUT  NOT   LIMITED    TO   THE   WARRANTIES  OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR   PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS  OR   COPYRIGHT  HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER   IN  AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM,  OUT  OF   OR  IN  CONNECTION  WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "ring_buf_cobs.h"
+#include "ring_buf_find.h"
+
+#include <stdint.h>
+#include <string.h>
+
+/*!
+ * \brief Longest block.
+ * \details A code byte of this value leads 254 non-zero bytes and implies no
+ * zero after them.
+ */
+#define RING_BUF_COBS_BLOCK 0xffU
+
+/*!
+ * \brief Encoder writing through a pair of free spans.
+ */
+struct ring_buf_cobs_encoder {
+  /*!
+   * \brief Next byte to write.
+   */
+  uint8_t *at;
+
+  /*!
+   * \brief End of the current span.
+   */
+  uint8_t *end;
+
+  /*!
+   * \brief Second span, taken on reaching the end of the first.
+   */
+  struct ring_buf_span next;
+
+  /*!
+   * \brief Where the current block's code byte goes.
+   */
+  uint8_t *code;
+
+  /*!
+   * \brief Current block's code, one more than its non-zero bytes so far.
+   */
+  uint8_t run;
+
+  /*!
+   * \brief Number of bytes written.
+   */
+  ring_buf_size_t count;
+};
+
+/*!
+ * \brief Takes the next byte of free space.
+ * \details The caller has already checked for enough free space.
+ * \param encoder Encoder.
+ * \returns Address of the byte taken.
+ */
+static uint8_t *ring_buf_cobs_take(struct ring_buf_cobs_encoder *encoder) {
+  uint8_t *at = encoder->at++;
+  if (encoder->at == encoder->end) {
+    encoder->at = encoder->next.space;
+    encoder->end = encoder->at + encoder->next.size;
+  }
+  encoder->count++;
+  return at;
+}
+
+/*!
+ * \brief Encodes bytes into the current frame.
+ * \details Closes a full block only once another byte follows, so that a
+ * frame ending on a full block needs no empty block after it.
+ * \param encoder Encoder.
+ * \param data Address of bytes to encode.
+ * \param size Number of bytes to encode.
+ */
+static void ring_buf_cobs_encode(struct ring_buf_cobs_encoder *encoder,
+                                 const uint8_t *data, ring_buf_size_t size) {
+  for (; size; size--) {
+    const uint8_t byte = *data++;
+    if (encoder->run == RING_BUF_COBS_BLOCK) {
+      *encoder->code = encoder->run;
+      encoder->code = ring_buf_cobs_take(encoder);
+      encoder->run = 1U;
+    }
+    if (byte == 0U) {
+      *encoder->code = encoder->run;
+      encoder->code = ring_buf_cobs_take(encoder);
+      encoder->run = 1U;
+    } else {
+      *ring_buf_cobs_take(encoder) = byte;
+      encoder->run++;
+    }
+  }
+}
+
+int ring_buf_cobs_putv(struct ring_buf *buf, const struct ring_buf_iovec *iov,
+                       int iovcnt) {
+  ring_buf_size_t size = 0U;
+  for (int i = 0; i < iovcnt; i++)
+    size += iov[i].size;
+  struct ring_buf_span spans[2];
+  if (RING_BUF_COBS_MAX(size) > ring_buf_free_spans(buf, spans))
+    return -EMSGSIZE;
+  struct ring_buf_cobs_encoder encoder = {
+      .at = spans[0].space,
+      .end = (uint8_t *)spans[0].space + spans[0].size,
+      .next = spans[1],
+      .run = 1U,
+  };
+  encoder.code = ring_buf_cobs_take(&encoder);
+  for (int i = 0; i < iovcnt; i++)
+    ring_buf_cobs_encode(&encoder, iov[i].data, iov[i].size);
+  *encoder.code = encoder.run;
+  *ring_buf_cobs_take(&encoder) = 0U;
+  return ring_buf_put(buf, NULL, encoder.count);
+}
+
+int ring_buf_cobs_put(struct ring_buf *buf, const void *data,
+                      ring_buf_size_t size) {
+  const struct ring_buf_iovec iov = {(void *)data, size};
+  return ring_buf_cobs_putv(buf, &iov, 1);
+}
+
+/*!
+ * \brief Decodes an encoded frame from a pair of used spans.
+ * \details Copies each block's non-zero bytes as at most two runs, then
+ * the zero that the block's code implies, if any.
+ * \param spans Array of two spans starting at the frame.
+ * \param frame Number of encoded bytes before the delimiter.
+ * \param data Address of bytes to fill, or \c NULL to count only.
+ * \param size Maximum number of decoded bytes.
+ * \returns Decoded length, or a negative error number.
+ */
+static int ring_buf_cobs_decode(const struct ring_buf_span spans[2],
+                                ring_buf_size_t frame, uint8_t *data,
+                                ring_buf_size_t size) {
+  if (frame == 0U)
+    return -EBADMSG;
+  ring_buf_size_t offset = 0U, length = 0U;
+  while (offset < frame) {
+    uint8_t code;
+    ring_buf_span_read(spans, offset, &code, sizeof(code));
+    if (code > frame - offset)
+      return -EBADMSG;
+    const ring_buf_size_t run = code - 1U;
+    offset += code;
+    const bool zero = code != RING_BUF_COBS_BLOCK && offset < frame;
+    if (run + zero > size - length)
+      return -EMSGSIZE;
+    if (data) {
+      ring_buf_span_read(spans, offset - run, data + length, run);
+      if (zero)
+        data[length + run] = 0U;
+    }
+    length += run + zero;
+  }
+  return length;
+}
+
+int ring_buf_cobs_get(struct ring_buf *buf, void *data, ring_buf_size_t size,
+                      ring_buf_size_t *length) {
+  const ring_buf_ptrdiff_t frame = ring_buf_find_byte(buf, 0U, 0U);
+  if (frame < 0)
+    return frame;
+  struct ring_buf_span spans[2];
+  (void)ring_buf_used_spans(buf, spans);
+  const int decoded = ring_buf_cobs_decode(spans, frame, data, size);
+  if (decoded < 0)
+    return decoded;
+  *length = decoded;
+  return ring_buf_get(buf, NULL, frame + 1);
+}
+
+int ring_buf_cobs_skip(struct ring_buf *buf) {
+  const ring_buf_ptrdiff_t frame = ring_buf_find_byte(buf, 0U, 0U);
+  if (frame < 0)
+    return frame;
+  return ring_buf_get(buf, NULL, frame + 1);
+}
@@ -0,0 +1,549 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: 2026, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+/*!
+ * \file ring_buf_crc.c
+ * \brief Ring buffer CRC functions.
+ * \details Implements slicing-by-eight CRC-32/MPEG-2 in software and on the
+ * STM32F4 CRC peripheral.
+ * \copyright 2026, Roy Ratcliffe, Northumberland, United Kingdom
+ *
+ * Permission is hereby granted, free of charge,  to any person obtaining a
+ * copy  of  this  software  and    associated   documentation  files  (the
+ * "Software"), to deal in  the   Software  without  restriction, including
+ * without limitation the rights to  use,   copy,  modify,  merge, publish,
+ * distribute, sublicense, and/or sell  copies  of   the  Software,  and to
+ * permit persons to whom the Software is   furnished  to do so, subject to
+ * the following conditions:
+ *
+ *     The above copyright notice and this permission notice shall be
+ *     included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT  WARRANTY OF ANY KIND, EXPRESS
+ * OR  IMPLIED,  INCLUDING  BUT  NOT   LIMITED    TO   THE   WARRANTIES  OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR   PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS  OR   COPYRIGHT  HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER   IN  AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM,  OUT  OF   OR  IN  CONNECTION  WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "ring_buf_crc.h"
+
+#ifdef RING_BUF_CRC_HW
+#include "stm32f4xx.h"
+#endif
+
+/*!
+ * \brief CRC-32 polynomial, most significant bit first.
+ */
+#define RING_BUF_CRC32_POLY 0x04c11db7U
+
+/*!
+ * \brief Slicing tables.
+ * \details Table zero advances the CRC over one byte. Table \e k advances it
+ * over one byte followed by \e k zero bytes. Constant, so they live in flash
+ * rather than taking eight kilobytes of RAM.
+ */
+static const uint32_t ring_buf_crc32_table[8][256] = {
+    {0x00000000U, 0x04c11db7U, 0x09823b6eU, 0x0d4326d9U, 0x130476dcU,
+     0x17c56b6bU, 0x1a864db2U, 0x1e475005U, 0x2608edb8U, 0x22c9f00fU,
+     0x2f8ad6d6U, 0x2b4bcb61U, 0x350c9b64U, 0x31cd86d3U, 0x3c8ea00aU,
+     0x384fbdbdU, 0x4c11db70U, 0x48d0c6c7U, 0x4593e01eU, 0x4152fda9U,
+     0x5f15adacU, 0x5bd4b01bU, 0x569796c2U, 0x52568b75U, 0x6a1936c8U,
+     0x6ed82b7fU, 0x639b0da6U, 0x675a1011U, 0x791d4014U, 0x7ddc5da3U,
+     0x709f7b7aU, 0x745e66cdU, 0x9823b6e0U, 0x9ce2ab57U, 0x91a18d8eU,
+     0x95609039U, 0x8b27c03cU, 0x8fe6dd8bU, 0x82a5fb52U, 0x8664e6e5U,
+     0xbe2b5b58U, 0xbaea46efU, 0xb7a96036U, 0xb3687d81U, 0xad2f2d84U,
+     0xa9ee3033U, 0xa4ad16eaU, 0xa06c0b5dU, 0xd4326d90U, 0xd0f37027U,
+     0xddb056feU, 0xd9714b49U, 0xc7361b4cU, 0xc3f706fbU, 0xceb42022U,
+     0xca753d95U, 0xf23a8028U, 0xf6fb9d9fU, 0xfbb8bb46U, 0xff79a6f1U,
+     0xe13ef6f4U, 0xe5ffeb43U, 0xe8bccd9aU, 0xec7dd02dU, 0x34867077U,
+     0x30476dc0U, 0x3d044b19U, 0x39c556aeU, 0x278206abU, 0x23431b1cU,
+     0x2e003dc5U, 0x2ac12072U, 0x128e9dcfU, 0x164f8078U, 0x1b0ca6a1U,
+     0x1fcdbb16U, 0x018aeb13U, 0x054bf6a4U, 0x0808d07dU, 0x0cc9cdcaU,
+     0x7897ab07U, 0x7c56b6b0U, 0x71159069U, 0x75d48ddeU, 0x6b93dddbU,
+     0x6f52c06cU, 0x6211e6b5U, 0x66d0fb02U, 0x5e9f46bfU, 0x5a5e5b08U,
+     0x571d7dd1U, 0x53dc6066U, 0x4d9b3063U, 0x495a2dd4U, 0x44190b0dU,
+     0x40d816baU, 0xaca5c697U, 0xa864db20U, 0xa527fdf9U, 0xa1e6e04eU,
+     0xbfa1b04bU, 0xbb60adfcU, 0xb6238b25U, 0xb2e29692U, 0x8aad2b2fU,
+     0x8e6c3698U, 0x832f1041U, 0x87ee0df6U, 0x99a95df3U, 0x9d684044U,
+     0x902b669dU, 0x94ea7b2aU, 0xe0b41de7U, 0xe4750050U, 0xe9362689U,
+     0xedf73b3eU, 0xf3b06b3bU, 0xf771768cU, 0xfa325055U, 0xfef34de2U,
+     0xc6bcf05fU, 0xc27dede8U, 0xcf3ecb31U, 0xcbffd686U, 0xd5b88683U,
+     0xd1799b34U, 0xdc3abdedU, 0xd8fba05aU, 0x690ce0eeU, 0x6dcdfd59U,
+     0x608edb80U, 0x644fc637U, 0x7a089632U, 0x7ec98b85U, 0x738aad5cU,
+     0x774bb0ebU, 0x4f040d56U, 0x4bc510e1U, 0x46863638U, 0x42472b8fU,
+     0x5c007b8aU, 0x58c1663dU, 0x558240e4U, 0x51435d53U, 0x251d3b9eU,
+     0x21dc2629U, 0x2c9f00f0U, 0x285e1d47U, 0x36194d42U, 0x32d850f5U,
+     0x3f9b762cU, 0x3b5a6b9bU, 0x0315d626U, 0x07d4cb91U, 0x0a97ed48U,
+     0x0e56f0ffU, 0x1011a0faU, 0x14d0bd4dU, 0x19939b94U, 0x1d528623U,
+     0xf12f560eU, 0xf5ee4bb9U, 0xf8ad6d60U, 0xfc6c70d7U, 0xe22b20d2U,
+     0xe6ea3d65U, 0xeba91bbcU, 0xef68060bU, 0xd727bbb6U, 0xd3e6a601U,
+     0xdea580d8U, 0xda649d6fU, 0xc423cd6aU, 0xc0e2d0ddU, 0xcda1f604U,
+     0xc960ebb3U, 0xbd3e8d7eU, 0xb9ff90c9U, 0xb4bcb610U, 0xb07daba7U,
+     0xae3afba2U, 0xaafbe615U, 0xa7b8c0ccU, 0xa379dd7bU, 0x9b3660c6U,
+     0x9ff77d71U, 0x92b45ba8U, 0x9675461fU, 0x8832161aU, 0x8cf30badU,
+     0x81b02d74U, 0x857130c3U, 0x5d8a9099U, 0x594b8d2eU, 0x5408abf7U,
+     0x50c9b640U, 0x4e8ee645U, 0x4a4ffbf2U, 0x470cdd2bU, 0x43cdc09cU,
+     0x7b827d21U, 0x7f436096U, 0x7200464fU, 0x76c15bf8U, 0x68860bfdU,
+     0x6c47164aU, 0x61043093U, 0x65c52d24U, 0x119b4be9U, 0x155a565eU,
+     0x18197087U, 0x1cd86d30U, 0x029f3d35U, 0x065e2082U, 0x0b1d065bU,
+     0x0fdc1becU, 0x3793a651U, 0x3352bbe6U, 0x3e119d3fU, 0x3ad08088U,
+     0x2497d08dU, 0x2056cd3aU, 0x2d15ebe3U, 0x29d4f654U, 0xc5a92679U,
+     0xc1683bceU, 0xcc2b1d17U, 0xc8ea00a0U, 0xd6ad50a5U, 0xd26c4d12U,
+     0xdf2f6bcbU, 0xdbee767cU, 0xe3a1cbc1U, 0xe760d676U, 0xea23f0afU,
+     0xeee2ed18U, 0xf0a5bd1dU, 0xf464a0aaU, 0xf9278673U, 0xfde69bc4U,
+     0x89b8fd09U, 0x8d79e0beU, 0x803ac667U, 0x84fbdbd0U, 0x9abc8bd5U,
+     0x9e7d9662U, 0x933eb0bbU, 0x97ffad0cU, 0xafb010b1U, 0xab710d06U,
+     0xa6322bdfU, 0xa2f33668U, 0xbcb4666dU, 0xb8757bdaU, 0xb5365d03U,
+     0xb1f740b4U},
+    {0x00000000U, 0xd219c1dcU, 0xa0f29e0fU, 0x72eb5fd3U, 0x452421a9U,
+     0x973de075U, 0xe5d6bfa6U, 0x37cf7e7aU, 0x8a484352U, 0x5851828eU,
+     0x2abadd5dU, 0xf8a31c81U, 0xcf6c62fbU, 0x1d75a327U, 0x6f9efcf4U,
+     0xbd873d28U, 0x10519b13U, 0xc2485acfU, 0xb0a3051cU, 0x62bac4c0U,
+     0x5575babaU, 0x876c7b66U, 0xf58724b5U, 0x279ee569U, 0x9a19d841U,
+     0x4800199dU, 0x3aeb464eU, 0xe8f28792U, 0xdf3df9e8U, 0x0d243834U,
+     0x7fcf67e7U, 0xadd6a63bU, 0x20a33626U, 0xf2baf7faU, 0x8051a829U,
+     0x524869f5U, 0x6587178fU, 0xb79ed653U, 0xc5758980U, 0x176c485cU,
+     0xaaeb7574U, 0x78f2b4a8U, 0x0a19eb7bU, 0xd8002aa7U, 0xefcf54ddU,
+     0x3dd69501U, 0x4f3dcad2U, 0x9d240b0eU, 0x30f2ad35U, 0xe2eb6ce9U,
+     0x9000333aU, 0x4219f2e6U, 0x75d68c9cU, 0xa7cf4d40U, 0xd5241293U,
+     0x073dd34fU, 0xbabaee67U, 0x68a32fbbU, 0x1a487068U, 0xc851b1b4U,
+     0xff9ecfceU, 0x2d870e12U, 0x5f6c51c1U, 0x8d75901dU, 0x41466c4cU,
+     0x935fad90U, 0xe1b4f243U, 0x33ad339fU, 0x04624de5U, 0xd67b8c39U,
+     0xa490d3eaU, 0x76891236U, 0xcb0e2f1eU, 0x1917eec2U, 0x6bfcb111U,
+     0xb9e570cdU, 0x8e2a0eb7U, 0x5c33cf6bU, 0x2ed890b8U, 0xfcc15164U,
+     0x5117f75fU, 0x830e3683U, 0xf1e56950U, 0x23fca88cU, 0x1433d6f6U,
+     0xc62a172aU, 0xb4c148f9U, 0x66d88925U, 0xdb5fb40dU, 0x094675d1U,
+     0x7bad2a02U, 0xa9b4ebdeU, 0x9e7b95a4U, 0x4c625478U, 0x3e890babU,
+     0xec90ca77U, 0x61e55a6aU, 0xb3fc9bb6U, 0xc117c465U, 0x130e05b9U,
+     0x24c17bc3U, 0xf6d8ba1fU, 0x8433e5ccU, 0x562a2410U, 0xebad1938U,
+     0x39b4d8e4U, 0x4b5f8737U, 0x994646ebU, 0xae893891U, 0x7c90f94dU,
+     0x0e7ba69eU, 0xdc626742U, 0x71b4c179U, 0xa3ad00a5U, 0xd1465f76U,
+     0x035f9eaaU, 0x3490e0d0U, 0xe689210cU, 0x94627edfU, 0x467bbf03U,
+     0xfbfc822bU, 0x29e543f7U, 0x5b0e1c24U, 0x8917ddf8U, 0xbed8a382U,
+     0x6cc1625eU, 0x1e2a3d8dU, 0xcc33fc51U, 0x828cd898U, 0x50951944U,
+     0x227e4697U, 0xf067874bU, 0xc7a8f931U, 0x15b138edU, 0x675a673eU,
+     0xb543a6e2U, 0x08c49bcaU, 0xdadd5a16U, 0xa83605c5U, 0x7a2fc419U,
+     0x4de0ba63U, 0x9ff97bbfU, 0xed12246cU, 0x3f0be5b0U, 0x92dd438bU,
+     0x40c48257U, 0x322fdd84U, 0xe0361c58U, 0xd7f96222U, 0x05e0a3feU,
+     0x770bfc2dU, 0xa5123df1U, 0x189500d9U, 0xca8cc105U, 0xb8679ed6U,
+     0x6a7e5f0aU, 0x5db12170U, 0x8fa8e0acU, 0xfd43bf7fU, 0x2f5a7ea3U,
+     0xa22feebeU, 0x70362f62U, 0x02dd70b1U, 0xd0c4b16dU, 0xe70bcf17U,
+     0x35120ecbU, 0x47f95118U, 0x95e090c4U, 0x2867adecU, 0xfa7e6c30U,
+     0x889533e3U, 0x5a8cf23fU, 0x6d438c45U, 0xbf5a4d99U, 0xcdb1124aU,
+     0x1fa8d396U, 0xb27e75adU, 0x6067b471U, 0x128ceba2U, 0xc0952a7eU,
+     0xf75a5404U, 0x254395d8U, 0x57a8ca0bU, 0x85b10bd7U, 0x383636ffU,
+     0xea2ff723U, 0x98c4a8f0U, 0x4add692cU, 0x7d121756U, 0xaf0bd68aU,
+     0xdde08959U, 0x0ff94885U, 0xc3cab4d4U, 0x11d37508U, 0x63382adbU,
+     0xb121eb07U, 0x86ee957dU, 0x54f754a1U, 0x261c0b72U, 0xf405caaeU,
+     0x4982f786U, 0x9b9b365aU, 0xe9706989U, 0x3b69a855U, 0x0ca6d62fU,
+     0xdebf17f3U, 0xac544820U, 0x7e4d89fcU, 0xd39b2fc7U, 0x0182ee1bU,
+     0x7369b1c8U, 0xa1707014U, 0x96bf0e6eU, 0x44a6cfb2U, 0x364d9061U,
+     0xe45451bdU, 0x59d36c95U, 0x8bcaad49U, 0xf921f29aU, 0x2b383346U,
+     0x1cf74d3cU, 0xceee8ce0U, 0xbc05d333U, 0x6e1c12efU, 0xe36982f2U,
+     0x3170432eU, 0x439b1cfdU, 0x9182dd21U, 0xa64da35bU, 0x74546287U,
+     0x06bf3d54U, 0xd4a6fc88U, 0x6921c1a0U, 0xbb38007cU, 0xc9d35fafU,
+     0x1bca9e73U, 0x2c05e009U, 0xfe1c21d5U, 0x8cf77e06U, 0x5eeebfdaU,
+     0xf33819e1U, 0x2121d83dU, 0x53ca87eeU, 0x81d34632U, 0xb61c3848U,
+     0x6405f994U, 0x16eea647U, 0xc4f7679bU, 0x79705ab3U, 0xab699b6fU,
+     0xd982c4bcU, 0x0b9b0560U, 0x3c547b1aU, 0xee4dbac6U, 0x9ca6e515U,
+     0x4ebf24c9U},
+    {0x00000000U, 0x01d8ac87U, 0x03b1590eU, 0x0269f589U, 0x0762b21cU,
+     0x06ba1e9bU, 0x04d3eb12U, 0x050b4795U, 0x0ec56438U, 0x0f1dc8bfU,
+     0x0d743d36U, 0x0cac91b1U, 0x09a7d624U, 0x087f7aa3U, 0x0a168f2aU,
+     0x0bce23adU, 0x1d8ac870U, 0x1c5264f7U, 0x1e3b917eU, 0x1fe33df9U,
+     0x1ae87a6cU, 0x1b30d6ebU, 0x19592362U, 0x18818fe5U, 0x134fac48U,
+     0x129700cfU, 0x10fef546U, 0x112659c1U, 0x142d1e54U, 0x15f5b2d3U,
+     0x179c475aU, 0x1644ebddU, 0x3b1590e0U, 0x3acd3c67U, 0x38a4c9eeU,
+     0x397c6569U, 0x3c7722fcU, 0x3daf8e7bU, 0x3fc67bf2U, 0x3e1ed775U,
+     0x35d0f4d8U, 0x3408585fU, 0x3661add6U, 0x37b90151U, 0x32b246c4U,
+     0x336aea43U, 0x31031fcaU, 0x30dbb34dU, 0x269f5890U, 0x2747f417U,
+     0x252e019eU, 0x24f6ad19U, 0x21fdea8cU, 0x2025460bU, 0x224cb382U,
+     0x23941f05U, 0x285a3ca8U, 0x2982902fU, 0x2beb65a6U, 0x2a33c921U,
+     0x2f388eb4U, 0x2ee02233U, 0x2c89d7baU, 0x2d517b3dU, 0x762b21c0U,
+     0x77f38d47U, 0x759a78ceU, 0x7442d449U, 0x714993dcU, 0x70913f5bU,
+     0x72f8cad2U, 0x73206655U, 0x78ee45f8U, 0x7936e97fU, 0x7b5f1cf6U,
+     0x7a87b071U, 0x7f8cf7e4U, 0x7e545b63U, 0x7c3daeeaU, 0x7de5026dU,
+     0x6ba1e9b0U, 0x6a794537U, 0x6810b0beU, 0x69c81c39U, 0x6cc35bacU,
+     0x6d1bf72bU, 0x6f7202a2U, 0x6eaaae25U, 0x65648d88U, 0x64bc210fU,
+     0x66d5d486U, 0x670d7801U, 0x62063f94U, 0x63de9313U, 0x61b7669aU,
+     0x606fca1dU, 0x4d3eb120U, 0x4ce61da7U, 0x4e8fe82eU, 0x4f5744a9U,
+     0x4a5c033cU, 0x4b84afbbU, 0x49ed5a32U, 0x4835f6b5U, 0x43fbd518U,
+     0x4223799fU, 0x404a8c16U, 0x41922091U, 0x44996704U, 0x4541cb83U,
+     0x47283e0aU, 0x46f0928dU, 0x50b47950U, 0x516cd5d7U, 0x5305205eU,
+     0x52dd8cd9U, 0x57d6cb4cU, 0x560e67cbU, 0x54679242U, 0x55bf3ec5U,
+     0x5e711d68U, 0x5fa9b1efU, 0x5dc04466U, 0x5c18e8e1U, 0x5913af74U,
+     0x58cb03f3U, 0x5aa2f67aU, 0x5b7a5afdU, 0xec564380U, 0xed8eef07U,
+     0xefe71a8eU, 0xee3fb609U, 0xeb34f19cU, 0xeaec5d1bU, 0xe885a892U,
+     0xe95d0415U, 0xe29327b8U, 0xe34b8b3fU, 0xe1227eb6U, 0xe0fad231U,
+     0xe5f195a4U, 0xe4293923U, 0xe640ccaaU, 0xe798602dU, 0xf1dc8bf0U,
+     0xf0042777U, 0xf26dd2feU, 0xf3b57e79U, 0xf6be39ecU, 0xf766956bU,
+     0xf50f60e2U, 0xf4d7cc65U, 0xff19efc8U, 0xfec1434fU, 0xfca8b6c6U,
+     0xfd701a41U, 0xf87b5dd4U, 0xf9a3f153U, 0xfbca04daU, 0xfa12a85dU,
+     0xd743d360U, 0xd69b7fe7U, 0xd4f28a6eU, 0xd52a26e9U, 0xd021617cU,
+     0xd1f9cdfbU, 0xd3903872U, 0xd24894f5U, 0xd986b758U, 0xd85e1bdfU,
+     0xda37ee56U, 0xdbef42d1U, 0xdee40544U, 0xdf3ca9c3U, 0xdd555c4aU,
+     0xdc8df0cdU, 0xcac91b10U, 0xcb11b797U, 0xc978421eU, 0xc8a0ee99U,
+     0xcdaba90cU, 0xcc73058bU, 0xce1af002U, 0xcfc25c85U, 0xc40c7f28U,
+     0xc5d4d3afU, 0xc7bd2626U, 0xc6658aa1U, 0xc36ecd34U, 0xc2b661b3U,
+     0xc0df943aU, 0xc10738bdU, 0x9a7d6240U, 0x9ba5cec7U, 0x99cc3b4eU,
+     0x981497c9U, 0x9d1fd05cU, 0x9cc77cdbU, 0x9eae8952U, 0x9f7625d5U,
+     0x94b80678U, 0x9560aaffU, 0x97095f76U, 0x96d1f3f1U, 0x93dab464U,
+     0x920218e3U, 0x906bed6aU, 0x91b341edU, 0x87f7aa30U, 0x862f06b7U,
+     0x8446f33eU, 0x859e5fb9U, 0x8095182cU, 0x814db4abU, 0x83244122U,
+     0x82fceda5U, 0x8932ce08U, 0x88ea628fU, 0x8a839706U, 0x8b5b3b81U,
+     0x8e507c14U, 0x8f88d093U, 0x8de1251aU, 0x8c39899dU, 0xa168f2a0U,
+     0xa0b05e27U, 0xa2d9abaeU, 0xa3010729U, 0xa60a40bcU, 0xa7d2ec3bU,
+     0xa5bb19b2U, 0xa463b535U, 0xafad9698U, 0xae753a1fU, 0xac1ccf96U,
+     0xadc46311U, 0xa8cf2484U, 0xa9178803U, 0xab7e7d8aU, 0xaaa6d10dU,
+     0xbce23ad0U, 0xbd3a9657U, 0xbf5363deU, 0xbe8bcf59U, 0xbb8088ccU,
+     0xba58244bU, 0xb831d1c2U, 0xb9e97d45U, 0xb2275ee8U, 0xb3fff26fU,
+     0xb19607e6U, 0xb04eab61U, 0xb545ecf4U, 0xb49d4073U, 0xb6f4b5faU,
+     0xb72c197dU},
+    {0x00000000U, 0xdc6d9ab7U, 0xbc1a28d9U, 0x6077b26eU, 0x7cf54c05U,
+     0xa098d6b2U, 0xc0ef64dcU, 0x1c82fe6bU, 0xf9ea980aU, 0x258702bdU,
+     0x45f0b0d3U, 0x999d2a64U, 0x851fd40fU, 0x59724eb8U, 0x3905fcd6U,
+     0xe5686661U, 0xf7142da3U, 0x2b79b714U, 0x4b0e057aU, 0x97639fcdU,
+     0x8be161a6U, 0x578cfb11U, 0x37fb497fU, 0xeb96d3c8U, 0x0efeb5a9U,
+     0xd2932f1eU, 0xb2e49d70U, 0x6e8907c7U, 0x720bf9acU, 0xae66631bU,
+     0xce11d175U, 0x127c4bc2U, 0xeae946f1U, 0x3684dc46U, 0x56f36e28U,
+     0x8a9ef49fU, 0x961c0af4U, 0x4a719043U, 0x2a06222dU, 0xf66bb89aU,
+     0x1303defbU, 0xcf6e444cU, 0xaf19f622U, 0x73746c95U, 0x6ff692feU,
+     0xb39b0849U, 0xd3ecba27U, 0x0f812090U, 0x1dfd6b52U, 0xc190f1e5U,
+     0xa1e7438bU, 0x7d8ad93cU, 0x61082757U, 0xbd65bde0U, 0xdd120f8eU,
+     0x017f9539U, 0xe417f358U, 0x387a69efU, 0x580ddb81U, 0x84604136U,
+     0x98e2bf5dU, 0x448f25eaU, 0x24f89784U, 0xf8950d33U, 0xd1139055U,
+     0x0d7e0ae2U, 0x6d09b88cU, 0xb164223bU, 0xade6dc50U, 0x718b46e7U,
+     0x11fcf489U, 0xcd916e3eU, 0x28f9085fU, 0xf49492e8U, 0x94e32086U,
+     0x488eba31U, 0x540c445aU, 0x8861deedU, 0xe8166c83U, 0x347bf634U,
+     0x2607bdf6U, 0xfa6a2741U, 0x9a1d952fU, 0x46700f98U, 0x5af2f1f3U,
+     0x869f6b44U, 0xe6e8d92aU, 0x3a85439dU, 0xdfed25fcU, 0x0380bf4bU,
+     0x63f70d25U, 0xbf9a9792U, 0xa31869f9U, 0x7f75f34eU, 0x1f024120U,
+     0xc36fdb97U, 0x3bfad6a4U, 0xe7974c13U, 0x87e0fe7dU, 0x5b8d64caU,
+     0x470f9aa1U, 0x9b620016U, 0xfb15b278U, 0x277828cfU, 0xc2104eaeU,
+     0x1e7dd419U, 0x7e0a6677U, 0xa267fcc0U, 0xbee502abU, 0x6288981cU,
+     0x02ff2a72U, 0xde92b0c5U, 0xcceefb07U, 0x108361b0U, 0x70f4d3deU,
+     0xac994969U, 0xb01bb702U, 0x6c762db5U, 0x0c019fdbU, 0xd06c056cU,
+     0x3504630dU, 0xe969f9baU, 0x891e4bd4U, 0x5573d163U, 0x49f12f08U,
+     0x959cb5bfU, 0xf5eb07d1U, 0x29869d66U, 0xa6e63d1dU, 0x7a8ba7aaU,
+     0x1afc15c4U, 0xc6918f73U, 0xda137118U, 0x067eebafU, 0x660959c1U,
+     0xba64c376U, 0x5f0ca517U, 0x83613fa0U, 0xe3168dceU, 0x3f7b1779U,
+     0x23f9e912U, 0xff9473a5U, 0x9fe3c1cbU, 0x438e5b7cU, 0x51f210beU,
+     0x8d9f8a09U, 0xede83867U, 0x3185a2d0U, 0x2d075cbbU, 0xf16ac60cU,
+     0x911d7462U, 0x4d70eed5U, 0xa81888b4U, 0x74751203U, 0x1402a06dU,
+     0xc86f3adaU, 0xd4edc4b1U, 0x08805e06U, 0x68f7ec68U, 0xb49a76dfU,
+     0x4c0f7becU, 0x9062e15bU, 0xf0155335U, 0x2c78c982U, 0x30fa37e9U,
+     0xec97ad5eU, 0x8ce01f30U, 0x508d8587U, 0xb5e5e3e6U, 0x69887951U,
+     0x09ffcb3fU, 0xd5925188U, 0xc910afe3U, 0x157d3554U, 0x750a873aU,
+     0xa9671d8dU, 0xbb1b564fU, 0x6776ccf8U, 0x07017e96U, 0xdb6ce421U,
+     0xc7ee1a4aU, 0x1b8380fdU, 0x7bf43293U, 0xa799a824U, 0x42f1ce45U,
+     0x9e9c54f2U, 0xfeebe69cU, 0x22867c2bU, 0x3e048240U, 0xe26918f7U,
+     0x821eaa99U, 0x5e73302eU, 0x77f5ad48U, 0xab9837ffU, 0xcbef8591U,
+     0x17821f26U, 0x0b00e14dU, 0xd76d7bfaU, 0xb71ac994U, 0x6b775323U,
+     0x8e1f3542U, 0x5272aff5U, 0x32051d9bU, 0xee68872cU, 0xf2ea7947U,
+     0x2e87e3f0U, 0x4ef0519eU, 0x929dcb29U, 0x80e180ebU, 0x5c8c1a5cU,
+     0x3cfba832U, 0xe0963285U, 0xfc14cceeU, 0x20795659U, 0x400ee437U,
+     0x9c637e80U, 0x790b18e1U, 0xa5668256U, 0xc5113038U, 0x197caa8fU,
+     0x05fe54e4U, 0xd993ce53U, 0xb9e47c3dU, 0x6589e68aU, 0x9d1cebb9U,
+     0x4171710eU, 0x2106c360U, 0xfd6b59d7U, 0xe1e9a7bcU, 0x3d843d0bU,
+     0x5df38f65U, 0x819e15d2U, 0x64f673b3U, 0xb89be904U, 0xd8ec5b6aU,
+     0x0481c1ddU, 0x18033fb6U, 0xc46ea501U, 0xa419176fU, 0x78748dd8U,
+     0x6a08c61aU, 0xb6655cadU, 0xd612eec3U, 0x0a7f7474U, 0x16fd8a1fU,
+     0xca9010a8U, 0xaae7a2c6U, 0x768a3871U, 0x93e25e10U, 0x4f8fc4a7U,
+     0x2ff876c9U, 0xf395ec7eU, 0xef171215U, 0x337a88a2U, 0x530d3accU,
+     0x8f60a07bU},
+    {0x00000000U, 0x490d678dU, 0x921acf1aU, 0xdb17a897U, 0x20f48383U,
+     0x69f9e40eU, 0xb2ee4c99U, 0xfbe32b14U, 0x41e90706U, 0x08e4608bU,
+     0xd3f3c81cU, 0x9afeaf91U, 0x611d8485U, 0x2810e308U, 0xf3074b9fU,
+     0xba0a2c12U, 0x83d20e0cU, 0xcadf6981U, 0x11c8c116U, 0x58c5a69bU,
+     0xa3268d8fU, 0xea2bea02U, 0x313c4295U, 0x78312518U, 0xc23b090aU,
+     0x8b366e87U, 0x5021c610U, 0x192ca19dU, 0xe2cf8a89U, 0xabc2ed04U,
+     0x70d54593U, 0x39d8221eU, 0x036501afU, 0x4a686622U, 0x917fceb5U,
+     0xd872a938U, 0x2391822cU, 0x6a9ce5a1U, 0xb18b4d36U, 0xf8862abbU,
+     0x428c06a9U, 0x0b816124U, 0xd096c9b3U, 0x999bae3eU, 0x6278852aU,
+     0x2b75e2a7U, 0xf0624a30U, 0xb96f2dbdU, 0x80b70fa3U, 0xc9ba682eU,
+     0x12adc0b9U, 0x5ba0a734U, 0xa0438c20U, 0xe94eebadU, 0x3259433aU,
+     0x7b5424b7U, 0xc15e08a5U, 0x88536f28U, 0x5344c7bfU, 0x1a49a032U,
+     0xe1aa8b26U, 0xa8a7ecabU, 0x73b0443cU, 0x3abd23b1U, 0x06ca035eU,
+     0x4fc764d3U, 0x94d0cc44U, 0xddddabc9U, 0x263e80ddU, 0x6f33e750U,
+     0xb4244fc7U, 0xfd29284aU, 0x47230458U, 0x0e2e63d5U, 0xd539cb42U,
+     0x9c34accfU, 0x67d787dbU, 0x2edae056U, 0xf5cd48c1U, 0xbcc02f4cU,
+     0x85180d52U, 0xcc156adfU, 0x1702c248U, 0x5e0fa5c5U, 0xa5ec8ed1U,
+     0xece1e95cU, 0x37f641cbU, 0x7efb2646U, 0xc4f10a54U, 0x8dfc6dd9U,
+     0x56ebc54eU, 0x1fe6a2c3U, 0xe40589d7U, 0xad08ee5aU, 0x761f46cdU,
+     0x3f122140U, 0x05af02f1U, 0x4ca2657cU, 0x97b5cdebU, 0xdeb8aa66U,
+     0x255b8172U, 0x6c56e6ffU, 0xb7414e68U, 0xfe4c29e5U, 0x444605f7U,
+     0x0d4b627aU, 0xd65ccaedU, 0x9f51ad60U, 0x64b28674U, 0x2dbfe1f9U,
+     0xf6a8496eU, 0xbfa52ee3U, 0x867d0cfdU, 0xcf706b70U, 0x1467c3e7U,
+     0x5d6aa46aU, 0xa6898f7eU, 0xef84e8f3U, 0x34934064U, 0x7d9e27e9U,
+     0xc7940bfbU, 0x8e996c76U, 0x558ec4e1U, 0x1c83a36cU, 0xe7608878U,
+     0xae6deff5U, 0x757a4762U, 0x3c7720efU, 0x0d9406bcU, 0x44996131U,
+     0x9f8ec9a6U, 0xd683ae2bU, 0x2d60853fU, 0x646de2b2U, 0xbf7a4a25U,
+     0xf6772da8U, 0x4c7d01baU, 0x05706637U, 0xde67cea0U, 0x976aa92dU,
+     0x6c898239U, 0x2584e5b4U, 0xfe934d23U, 0xb79e2aaeU, 0x8e4608b0U,
+     0xc74b6f3dU, 0x1c5cc7aaU, 0x5551a027U, 0xaeb28b33U, 0xe7bfecbeU,
+     0x3ca84429U, 0x75a523a4U, 0xcfaf0fb6U, 0x86a2683bU, 0x5db5c0acU,
+     0x14b8a721U, 0xef5b8c35U, 0xa656ebb8U, 0x7d41432fU, 0x344c24a2U,
+     0x0ef10713U, 0x47fc609eU, 0x9cebc809U, 0xd5e6af84U, 0x2e058490U,
+     0x6708e31dU, 0xbc1f4b8aU, 0xf5122c07U, 0x4f180015U, 0x06156798U,
+     0xdd02cf0fU, 0x940fa882U, 0x6fec8396U, 0x26e1e41bU, 0xfdf64c8cU,
+     0xb4fb2b01U, 0x8d23091fU, 0xc42e6e92U, 0x1f39c605U, 0x5634a188U,
+     0xadd78a9cU, 0xe4daed11U, 0x3fcd4586U, 0x76c0220bU, 0xccca0e19U,
+     0x85c76994U, 0x5ed0c103U, 0x17dda68eU, 0xec3e8d9aU, 0xa533ea17U,
+     0x7e244280U, 0x3729250dU, 0x0b5e05e2U, 0x4253626fU, 0x9944caf8U,
+     0xd049ad75U, 0x2baa8661U, 0x62a7e1ecU, 0xb9b0497bU, 0xf0bd2ef6U,
+     0x4ab702e4U, 0x03ba6569U, 0xd8adcdfeU, 0x91a0aa73U, 0x6a438167U,
+     0x234ee6eaU, 0xf8594e7dU, 0xb15429f0U, 0x888c0beeU, 0xc1816c63U,
+     0x1a96c4f4U, 0x539ba379U, 0xa878886dU, 0xe175efe0U, 0x3a624777U,
+     0x736f20faU, 0xc9650ce8U, 0x80686b65U, 0x5b7fc3f2U, 0x1272a47fU,
+     0xe9918f6bU, 0xa09ce8e6U, 0x7b8b4071U, 0x328627fcU, 0x083b044dU,
+     0x413663c0U, 0x9a21cb57U, 0xd32cacdaU, 0x28cf87ceU, 0x61c2e043U,
+     0xbad548d4U, 0xf3d82f59U, 0x49d2034bU, 0x00df64c6U, 0xdbc8cc51U,
+     0x92c5abdcU, 0x692680c8U, 0x202be745U, 0xfb3c4fd2U, 0xb231285fU,
+     0x8be90a41U, 0xc2e46dccU, 0x19f3c55bU, 0x50fea2d6U, 0xab1d89c2U,
+     0xe210ee4fU, 0x390746d8U, 0x700a2155U, 0xca000d47U, 0x830d6acaU,
+     0x581ac25dU, 0x1117a5d0U, 0xeaf48ec4U, 0xa3f9e949U, 0x78ee41deU,
+     0x31e32653U},
+    {0x00000000U, 0x1b280d78U, 0x36501af0U, 0x2d781788U, 0x6ca035e0U,
+     0x77883898U, 0x5af02f10U, 0x41d82268U, 0xd9406bc0U, 0xc26866b8U,
+     0xef107130U, 0xf4387c48U, 0xb5e05e20U, 0xaec85358U, 0x83b044d0U,
+     0x989849a8U, 0xb641ca37U, 0xad69c74fU, 0x8011d0c7U, 0x9b39ddbfU,
+     0xdae1ffd7U, 0xc1c9f2afU, 0xecb1e527U, 0xf799e85fU, 0x6f01a1f7U,
+     0x7429ac8fU, 0x5951bb07U, 0x4279b67fU, 0x03a19417U, 0x1889996fU,
+     0x35f18ee7U, 0x2ed9839fU, 0x684289d9U, 0x736a84a1U, 0x5e129329U,
+     0x453a9e51U, 0x04e2bc39U, 0x1fcab141U, 0x32b2a6c9U, 0x299aabb1U,
+     0xb102e219U, 0xaa2aef61U, 0x8752f8e9U, 0x9c7af591U, 0xdda2d7f9U,
+     0xc68ada81U, 0xebf2cd09U, 0xf0dac071U, 0xde0343eeU, 0xc52b4e96U,
+     0xe853591eU, 0xf37b5466U, 0xb2a3760eU, 0xa98b7b76U, 0x84f36cfeU,
+     0x9fdb6186U, 0x0743282eU, 0x1c6b2556U, 0x311332deU, 0x2a3b3fa6U,
+     0x6be31dceU, 0x70cb10b6U, 0x5db3073eU, 0x469b0a46U, 0xd08513b2U,
+     0xcbad1ecaU, 0xe6d50942U, 0xfdfd043aU, 0xbc252652U, 0xa70d2b2aU,
+     0x8a753ca2U, 0x915d31daU, 0x09c57872U, 0x12ed750aU, 0x3f956282U,
+     0x24bd6ffaU, 0x65654d92U, 0x7e4d40eaU, 0x53355762U, 0x481d5a1aU,
+     0x66c4d985U, 0x7decd4fdU, 0x5094c375U, 0x4bbcce0dU, 0x0a64ec65U,
+     0x114ce11dU, 0x3c34f695U, 0x271cfbedU, 0xbf84b245U, 0xa4acbf3dU,
+     0x89d4a8b5U, 0x92fca5cdU, 0xd32487a5U, 0xc80c8addU, 0xe5749d55U,
+     0xfe5c902dU, 0xb8c79a6bU, 0xa3ef9713U, 0x8e97809bU, 0x95bf8de3U,
+     0xd467af8bU, 0xcf4fa2f3U, 0xe237b57bU, 0xf91fb803U, 0x6187f1abU,
+     0x7aaffcd3U, 0x57d7eb5bU, 0x4cffe623U, 0x0d27c44bU, 0x160fc933U,
+     0x3b77debbU, 0x205fd3c3U, 0x0e86505cU, 0x15ae5d24U, 0x38d64aacU,
+     0x23fe47d4U, 0x622665bcU, 0x790e68c4U, 0x54767f4cU, 0x4f5e7234U,
+     0xd7c63b9cU, 0xccee36e4U, 0xe196216cU, 0xfabe2c14U, 0xbb660e7cU,
+     0xa04e0304U, 0x8d36148cU, 0x961e19f4U, 0xa5cb3ad3U, 0xbee337abU,
+     0x939b2023U, 0x88b32d5bU, 0xc96b0f33U, 0xd243024bU, 0xff3b15c3U,
+     0xe41318bbU, 0x7c8b5113U, 0x67a35c6bU, 0x4adb4be3U, 0x51f3469bU,
+     0x102b64f3U, 0x0b03698bU, 0x267b7e03U, 0x3d53737bU, 0x138af0e4U,
+     0x08a2fd9cU, 0x25daea14U, 0x3ef2e76cU, 0x7f2ac504U, 0x6402c87cU,
+     0x497adff4U, 0x5252d28cU, 0xcaca9b24U, 0xd1e2965cU, 0xfc9a81d4U,
+     0xe7b28cacU, 0xa66aaec4U, 0xbd42a3bcU, 0x903ab434U, 0x8b12b94cU,
+     0xcd89b30aU, 0xd6a1be72U, 0xfbd9a9faU, 0xe0f1a482U, 0xa12986eaU,
+     0xba018b92U, 0x97799c1aU, 0x8c519162U, 0x14c9d8caU, 0x0fe1d5b2U,
+     0x2299c23aU, 0x39b1cf42U, 0x7869ed2aU, 0x6341e052U, 0x4e39f7daU,
+     0x5511faa2U, 0x7bc8793dU, 0x60e07445U, 0x4d9863cdU, 0x56b06eb5U,
+     0x17684cddU, 0x0c4041a5U, 0x2138562dU, 0x3a105b55U, 0xa28812fdU,
+     0xb9a01f85U, 0x94d8080dU, 0x8ff00575U, 0xce28271dU, 0xd5002a65U,
+     0xf8783dedU, 0xe3503095U, 0x754e2961U, 0x6e662419U, 0x431e3391U,
+     0x58363ee9U, 0x19ee1c81U, 0x02c611f9U, 0x2fbe0671U, 0x34960b09U,
+     0xac0e42a1U, 0xb7264fd9U, 0x9a5e5851U, 0x81765529U, 0xc0ae7741U,
+     0xdb867a39U, 0xf6fe6db1U, 0xedd660c9U, 0xc30fe356U, 0xd827ee2eU,
+     0xf55ff9a6U, 0xee77f4deU, 0xafafd6b6U, 0xb487dbceU, 0x99ffcc46U,
+     0x82d7c13eU, 0x1a4f8896U, 0x016785eeU, 0x2c1f9266U, 0x37379f1eU,
+     0x76efbd76U, 0x6dc7b00eU, 0x40bfa786U, 0x5b97aafeU, 0x1d0ca0b8U,
+     0x0624adc0U, 0x2b5cba48U, 0x3074b730U, 0x71ac9558U, 0x6a849820U,
+     0x47fc8fa8U, 0x5cd482d0U, 0xc44ccb78U, 0xdf64c600U, 0xf21cd188U,
+     0xe934dcf0U, 0xa8ecfe98U, 0xb3c4f3e0U, 0x9ebce468U, 0x8594e910U,
+     0xab4d6a8fU, 0xb06567f7U, 0x9d1d707fU, 0x86357d07U, 0xc7ed5f6fU,
+     0xdcc55217U, 0xf1bd459fU, 0xea9548e7U, 0x720d014fU, 0x69250c37U,
+     0x445d1bbfU, 0x5f7516c7U, 0x1ead34afU, 0x058539d7U, 0x28fd2e5fU,
+     0x33d52327U},
+    {0x00000000U, 0x4f576811U, 0x9eaed022U, 0xd1f9b833U, 0x399cbdf3U,
+     0x76cbd5e2U, 0xa7326dd1U, 0xe86505c0U, 0x73397be6U, 0x3c6e13f7U,
+     0xed97abc4U, 0xa2c0c3d5U, 0x4aa5c615U, 0x05f2ae04U, 0xd40b1637U,
+     0x9b5c7e26U, 0xe672f7ccU, 0xa9259fddU, 0x78dc27eeU, 0x378b4fffU,
+     0xdfee4a3fU, 0x90b9222eU, 0x41409a1dU, 0x0e17f20cU, 0x954b8c2aU,
+     0xda1ce43bU, 0x0be55c08U, 0x44b23419U, 0xacd731d9U, 0xe38059c8U,
+     0x3279e1fbU, 0x7d2e89eaU, 0xc824f22fU, 0x87739a3eU, 0x568a220dU,
+     0x19dd4a1cU, 0xf1b84fdcU, 0xbeef27cdU, 0x6f169ffeU, 0x2041f7efU,
+     0xbb1d89c9U, 0xf44ae1d8U, 0x25b359ebU, 0x6ae431faU, 0x8281343aU,
+     0xcdd65c2bU, 0x1c2fe418U, 0x53788c09U, 0x2e5605e3U, 0x61016df2U,
+     0xb0f8d5c1U, 0xffafbdd0U, 0x17cab810U, 0x589dd001U, 0x89646832U,
+     0xc6330023U, 0x5d6f7e05U, 0x12381614U, 0xc3c1ae27U, 0x8c96c636U,
+     0x64f3c3f6U, 0x2ba4abe7U, 0xfa5d13d4U, 0xb50a7bc5U, 0x9488f9e9U,
+     0xdbdf91f8U, 0x0a2629cbU, 0x457141daU, 0xad14441aU, 0xe2432c0bU,
+     0x33ba9438U, 0x7cedfc29U, 0xe7b1820fU, 0xa8e6ea1eU, 0x791f522dU,
+     0x36483a3cU, 0xde2d3ffcU, 0x917a57edU, 0x4083efdeU, 0x0fd487cfU,
+     0x72fa0e25U, 0x3dad6634U, 0xec54de07U, 0xa303b616U, 0x4b66b3d6U,
+     0x0431dbc7U, 0xd5c863f4U, 0x9a9f0be5U, 0x01c375c3U, 0x4e941dd2U,
+     0x9f6da5e1U, 0xd03acdf0U, 0x385fc830U, 0x7708a021U, 0xa6f11812U,
+     0xe9a67003U, 0x5cac0bc6U, 0x13fb63d7U, 0xc202dbe4U, 0x8d55b3f5U,
+     0x6530b635U, 0x2a67de24U, 0xfb9e6617U, 0xb4c90e06U, 0x2f957020U,
+     0x60c21831U, 0xb13ba002U, 0xfe6cc813U, 0x1609cdd3U, 0x595ea5c2U,
+     0x88a71df1U, 0xc7f075e0U, 0xbadefc0aU, 0xf589941bU, 0x24702c28U,
+     0x6b274439U, 0x834241f9U, 0xcc1529e8U, 0x1dec91dbU, 0x52bbf9caU,
+     0xc9e787ecU, 0x86b0effdU, 0x574957ceU, 0x181e3fdfU, 0xf07b3a1fU,
+     0xbf2c520eU, 0x6ed5ea3dU, 0x2182822cU, 0x2dd0ee65U, 0x62878674U,
+     0xb37e3e47U, 0xfc295656U, 0x144c5396U, 0x5b1b3b87U, 0x8ae283b4U,
+     0xc5b5eba5U, 0x5ee99583U, 0x11befd92U, 0xc04745a1U, 0x8f102db0U,
+     0x67752870U, 0x28224061U, 0xf9dbf852U, 0xb68c9043U, 0xcba219a9U,
+     0x84f571b8U, 0x550cc98bU, 0x1a5ba19aU, 0xf23ea45aU, 0xbd69cc4bU,
+     0x6c907478U, 0x23c71c69U, 0xb89b624fU, 0xf7cc0a5eU, 0x2635b26dU,
+     0x6962da7cU, 0x8107dfbcU, 0xce50b7adU, 0x1fa90f9eU, 0x50fe678fU,
+     0xe5f41c4aU, 0xaaa3745bU, 0x7b5acc68U, 0x340da479U, 0xdc68a1b9U,
+     0x933fc9a8U, 0x42c6719bU, 0x0d91198aU, 0x96cd67acU, 0xd99a0fbdU,
+     0x0863b78eU, 0x4734df9fU, 0xaf51da5fU, 0xe006b24eU, 0x31ff0a7dU,
+     0x7ea8626cU, 0x0386eb86U, 0x4cd18397U, 0x9d283ba4U, 0xd27f53b5U,
+     0x3a1a5675U, 0x754d3e64U, 0xa4b48657U, 0xebe3ee46U, 0x70bf9060U,
+     0x3fe8f871U, 0xee114042U, 0xa1462853U, 0x49232d93U, 0x06744582U,
+     0xd78dfdb1U, 0x98da95a0U, 0xb958178cU, 0xf60f7f9dU, 0x27f6c7aeU,
+     0x68a1afbfU, 0x80c4aa7fU, 0xcf93c26eU, 0x1e6a7a5dU, 0x513d124cU,
+     0xca616c6aU, 0x8536047bU, 0x54cfbc48U, 0x1b98d459U, 0xf3fdd199U,
+     0xbcaab988U, 0x6d5301bbU, 0x220469aaU, 0x5f2ae040U, 0x107d8851U,
+     0xc1843062U, 0x8ed35873U, 0x66b65db3U, 0x29e135a2U, 0xf8188d91U,
+     0xb74fe580U, 0x2c139ba6U, 0x6344f3b7U, 0xb2bd4b84U, 0xfdea2395U,
+     0x158f2655U, 0x5ad84e44U, 0x8b21f677U, 0xc4769e66U, 0x717ce5a3U,
+     0x3e2b8db2U, 0xefd23581U, 0xa0855d90U, 0x48e05850U, 0x07b73041U,
+     0xd64e8872U, 0x9919e063U, 0x02459e45U, 0x4d12f654U, 0x9ceb4e67U,
+     0xd3bc2676U, 0x3bd923b6U, 0x748e4ba7U, 0xa577f394U, 0xea209b85U,
+     0x970e126fU, 0xd8597a7eU, 0x09a0c24dU, 0x46f7aa5cU, 0xae92af9cU,
+     0xe1c5c78dU, 0x303c7fbeU, 0x7f6b17afU, 0xe4376989U, 0xab600198U,
+     0x7a99b9abU, 0x35ced1baU, 0xddabd47aU, 0x92fcbc6bU, 0x43050458U,
+     0x0c526c49U},
+    {0x00000000U, 0x5ba1dccaU, 0xb743b994U, 0xece2655eU, 0x6a466e9fU,
+     0x31e7b255U, 0xdd05d70bU, 0x86a40bc1U, 0xd48cdd3eU, 0x8f2d01f4U,
+     0x63cf64aaU, 0x386eb860U, 0xbecab3a1U, 0xe56b6f6bU, 0x09890a35U,
+     0x5228d6ffU, 0xadd8a7cbU, 0xf6797b01U, 0x1a9b1e5fU, 0x413ac295U,
+     0xc79ec954U, 0x9c3f159eU, 0x70dd70c0U, 0x2b7cac0aU, 0x79547af5U,
+     0x22f5a63fU, 0xce17c361U, 0x95b61fabU, 0x1312146aU, 0x48b3c8a0U,
+     0xa451adfeU, 0xfff07134U, 0x5f705221U, 0x04d18eebU, 0xe833ebb5U,
+     0xb392377fU, 0x35363cbeU, 0x6e97e074U, 0x8275852aU, 0xd9d459e0U,
+     0x8bfc8f1fU, 0xd05d53d5U, 0x3cbf368bU, 0x671eea41U, 0xe1bae180U,
+     0xba1b3d4aU, 0x56f95814U, 0x0d5884deU, 0xf2a8f5eaU, 0xa9092920U,
+     0x45eb4c7eU, 0x1e4a90b4U, 0x98ee9b75U, 0xc34f47bfU, 0x2fad22e1U,
+     0x740cfe2bU, 0x262428d4U, 0x7d85f41eU, 0x91679140U, 0xcac64d8aU,
+     0x4c62464bU, 0x17c39a81U, 0xfb21ffdfU, 0xa0802315U, 0xbee0a442U,
+     0xe5417888U, 0x09a31dd6U, 0x5202c11cU, 0xd4a6caddU, 0x8f071617U,
+     0x63e57349U, 0x3844af83U, 0x6a6c797cU, 0x31cda5b6U, 0xdd2fc0e8U,
+     0x868e1c22U, 0x002a17e3U, 0x5b8bcb29U, 0xb769ae77U, 0xecc872bdU,
+     0x13380389U, 0x4899df43U, 0xa47bba1dU, 0xffda66d7U, 0x797e6d16U,
+     0x22dfb1dcU, 0xce3dd482U, 0x959c0848U, 0xc7b4deb7U, 0x9c15027dU,
+     0x70f76723U, 0x2b56bbe9U, 0xadf2b028U, 0xf6536ce2U, 0x1ab109bcU,
+     0x4110d576U, 0xe190f663U, 0xba312aa9U, 0x56d34ff7U, 0x0d72933dU,
+     0x8bd698fcU, 0xd0774436U, 0x3c952168U, 0x6734fda2U, 0x351c2b5dU,
+     0x6ebdf797U, 0x825f92c9U, 0xd9fe4e03U, 0x5f5a45c2U, 0x04fb9908U,
+     0xe819fc56U, 0xb3b8209cU, 0x4c4851a8U, 0x17e98d62U, 0xfb0be83cU,
+     0xa0aa34f6U, 0x260e3f37U, 0x7dafe3fdU, 0x914d86a3U, 0xcaec5a69U,
+     0x98c48c96U, 0xc365505cU, 0x2f873502U, 0x7426e9c8U, 0xf282e209U,
+     0xa9233ec3U, 0x45c15b9dU, 0x1e608757U, 0x79005533U, 0x22a189f9U,
+     0xce43eca7U, 0x95e2306dU, 0x13463bacU, 0x48e7e766U, 0xa4058238U,
+     0xffa45ef2U, 0xad8c880dU, 0xf62d54c7U, 0x1acf3199U, 0x416eed53U,
+     0xc7cae692U, 0x9c6b3a58U, 0x70895f06U, 0x2b2883ccU, 0xd4d8f2f8U,
+     0x8f792e32U, 0x639b4b6cU, 0x383a97a6U, 0xbe9e9c67U, 0xe53f40adU,
+     0x09dd25f3U, 0x527cf939U, 0x00542fc6U, 0x5bf5f30cU, 0xb7179652U,
+     0xecb64a98U, 0x6a124159U, 0x31b39d93U, 0xdd51f8cdU, 0x86f02407U,
+     0x26700712U, 0x7dd1dbd8U, 0x9133be86U, 0xca92624cU, 0x4c36698dU,
+     0x1797b547U, 0xfb75d019U, 0xa0d40cd3U, 0xf2fcda2cU, 0xa95d06e6U,
+     0x45bf63b8U, 0x1e1ebf72U, 0x98bab4b3U, 0xc31b6879U, 0x2ff90d27U,
+     0x7458d1edU, 0x8ba8a0d9U, 0xd0097c13U, 0x3ceb194dU, 0x674ac587U,
+     0xe1eece46U, 0xba4f128cU, 0x56ad77d2U, 0x0d0cab18U, 0x5f247de7U,
+     0x0485a12dU, 0xe867c473U, 0xb3c618b9U, 0x35621378U, 0x6ec3cfb2U,
+     0x8221aaecU, 0xd9807626U, 0xc7e0f171U, 0x9c412dbbU, 0x70a348e5U,
+     0x2b02942fU, 0xada69feeU, 0xf6074324U, 0x1ae5267aU, 0x4144fab0U,
+     0x136c2c4fU, 0x48cdf085U, 0xa42f95dbU, 0xff8e4911U, 0x792a42d0U,
+     0x228b9e1aU, 0xce69fb44U, 0x95c8278eU, 0x6a3856baU, 0x31998a70U,
+     0xdd7bef2eU, 0x86da33e4U, 0x007e3825U, 0x5bdfe4efU, 0xb73d81b1U,
+     0xec9c5d7bU, 0xbeb48b84U, 0xe515574eU, 0x09f73210U, 0x5256eedaU,
+     0xd4f2e51bU, 0x8f5339d1U, 0x63b15c8fU, 0x38108045U, 0x9890a350U,
+     0xc3317f9aU, 0x2fd31ac4U, 0x7472c60eU, 0xf2d6cdcfU, 0xa9771105U,
+     0x4595745bU, 0x1e34a891U, 0x4c1c7e6eU, 0x17bda2a4U, 0xfb5fc7faU,
+     0xa0fe1b30U, 0x265a10f1U, 0x7dfbcc3bU, 0x9119a965U, 0xcab875afU,
+     0x3548049bU, 0x6ee9d851U, 0x820bbd0fU, 0xd9aa61c5U, 0x5f0e6a04U,
+     0x04afb6ceU, 0xe84dd390U, 0xb3ec0f5aU, 0xe1c4d9a5U, 0xba65056fU,
+     0x56876031U, 0x0d26bcfbU, 0x8b82b73aU, 0xd0236bf0U, 0x3cc10eaeU,
+     0x6760d264U}
+};
+
+/*!
+ * \brief Loads a big-endian word.
+ * \param data Address of four bytes, any alignment.
+ * \returns Word with the first byte most significant.
+ */
+static inline uint32_t ring_buf_crc32_load(const uint8_t *data) {
+  return (uint32_t)data[0] << 24 | (uint32_t)data[1] << 16 |
+         (uint32_t)data[2] << 8 | data[3];
+}
+
+uint32_t ring_buf_crc32_sw(uint32_t crc, const void *data,
+                           ring_buf_size_t size) {
+  const uint32_t(*t)[256] = ring_buf_crc32_table;
+  const uint8_t *p = data;
+  for (; size >= 8U; size -= 8U, p += 8) {
+    const uint32_t hi = crc ^ ring_buf_crc32_load(p);
+    const uint32_t lo = ring_buf_crc32_load(p + 4);
+    crc = t[7][hi >> 24] ^ t[6][hi >> 16 & 0xffU] ^ t[5][hi >> 8 & 0xffU] ^
+          t[4][hi & 0xffU] ^ t[3][lo >> 24] ^ t[2][lo >> 16 & 0xffU] ^
+          t[1][lo >> 8 & 0xffU] ^ t[0][lo & 0xffU];
+  }
+  while (size--)
+    crc = crc << 8 ^ t[0][(crc >> 24 ^ *p++) & 0xffU];
+  return crc;
+}
+
+#ifdef RING_BUF_CRC_HW
+/*!
+ * \brief Runs the CRC backwards over one word of zeros.
+ * \details Undoes the 32 shifts that the peripheral applies to each word.
+ * The polynomial's lowest bit is set, so the lowest bit after a shift tells
+ * whether the polynomial went in.
+ * \param crc CRC after the word.
+ * \returns CRC before the word, less the word itself.
+ */
+static uint32_t ring_buf_crc32_unshift(uint32_t crc) {
+  for (int bit = 0; bit < 32; bit++)
+    crc = crc & 1U ? (crc ^ RING_BUF_CRC32_POLY) >> 1 | 0x80000000U : crc >> 1;
+  return crc;
+}
+
+uint32_t ring_buf_crc32_hw(uint32_t crc, const void *data,
+                           ring_buf_size_t size) {
+  const uint8_t *p = data;
+  const ring_buf_size_t lead = -(uintptr_t)p & 3U;
+  if (size < lead + 4U)
+    return ring_buf_crc32_sw(crc, p, size);
+  crc = ring_buf_crc32_sw(crc, p, lead);
+  p += lead;
+  size -= lead;
+  RCC->AHB1ENR |= RCC_AHB1ENR_CRCEN;
+  (void)RCC->AHB1ENR;
+  CRC->CR = CRC_CR_RESET;
+  CRC->DR = ring_buf_crc32_unshift(crc) ^ RING_BUF_CRC32_INIT;
+  const uint32_t *word = (const uint32_t *)p;
+  for (; size >= 4U; size -= 4U)
+    CRC->DR = __REV(*word++);
+  return ring_buf_crc32_sw(CRC->DR, word, size);
+}
+#endif
+
+uint32_t ring_buf_crc32(uint32_t crc, const void *data, ring_buf_size_t size) {
+#ifdef RING_BUF_CRC_HW
+  return ring_buf_crc32_hw(crc, data, size);
+#else
+  return ring_buf_crc32_sw(crc, data, size);
+#endif
+}
+
+uint32_t ring_buf_crc32_spans(uint32_t crc,
+                              const struct ring_buf_span spans[2]) {
+  crc = ring_buf_crc32(crc, spans[0].space, spans[0].size);
+  return ring_buf_crc32(crc, spans[1].space, spans[1].size);
+}
+
+uint32_t ring_buf_crc32_used(const struct ring_buf *buf,
+                             ring_buf_size_t offset, ring_buf_size_t size) {
+  struct ring_buf_span used[2], region[2];
+  (void)ring_buf_used_spans(buf, used);
+  ring_buf_span_slice(used, offset, size, region);
+  return ring_buf_crc32_spans(RING_BUF_CRC32_INIT, region);
+}
@@ -0,0 +1,150 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: 2026, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+/*!
+ * \file ring_buf_dma.c
+ * \brief Asynchronous ring buffer transfer functions.
+ * \details Implements the claim, copy and acknowledge state machine for
+ * transfer engines, plus the synchronous \c memcpy engine.
+ * \copyright 2026, Roy Ratcliffe, Northumberland, United Kingdom
+ *
+ * Permission is hereby granted, free of charge,  to any person obtaining a
+ * copy  of  this  software  and    associated   documentation  files  (the
+ * "Software"), to deal in  the   Software  without  restriction, including
+ * without limitation the rights to  use,   copy,  modify,  merge, publish,
+ * distribute, sublicense, and/or sell  copies  of   the  Software,  and to
+ * permit persons to whom the Software is   furnished  to do so, subject to
+ * the following conditions:
+ *
+ *     The above copyright notice and this permission notice shall be
+ *     included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT  WARRANTY OF ANY KIND, EXPRESS
+ * OR  IMPLIED,  INCLUDING  BUT  NOT   LIMITED    TO   THE   WARRANTIES  OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR   PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS  OR   COPYRIGHT  HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER   IN  AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM,  OUT  OF   OR  IN  CONNECTION  WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "ring_buf_dma.h"
+#include "ring_buf_spsc.h"
+
+#include <string.h>
+
+/*!
+ * \brief Acknowledges the current claim on the transfer's side.
+ * \param dma Asynchronous transfer.
+ * \param size Number of bytes to acknowledge, zero to abandon the claim.
+ */
+static void ring_buf_dma_ack(struct ring_buf_dma *dma, ring_buf_size_t size) {
+  if (dma->state == RING_BUF_DMA_PUT)
+    (void)ring_buf_spsc_put_ack(dma->buf, size);
+  else
+    (void)ring_buf_spsc_get_ack(dma->buf, size);
+}
+
+/*!
+ * \brief Claims and starts the next contiguous piece.
+ * \details The engine may complete before returning, and the completion may
+ * end the transfer; touch nothing after a successful start.
+ * \param dma Asynchronous transfer.
+ * \retval 0 if the piece started.
+ * \retval -EAGAIN if there is nothing to claim.
+ * \retval Other negative error numbers from the engine.
+ */
+static int ring_buf_dma_next(struct ring_buf_dma *dma) {
+  ring_buf_size_t size = dma->size;
+  if (dma->ops->max && size > dma->ops->max)
+    size = dma->ops->max;
+  void *space;
+  int err;
+  if (dma->state == RING_BUF_DMA_PUT) {
+    size = ring_buf_spsc_put_claim(dma->buf, &space, size);
+    if (size == 0U)
+      return -EAGAIN;
+    dma->chunk = size;
+    err = dma->ops->start(dma, space, dma->data, size);
+  } else {
+    size = ring_buf_spsc_get_claim(dma->buf, &space, size);
+    if (size == 0U)
+      return -EAGAIN;
+    dma->chunk = size;
+    err = dma->ops->start(dma, dma->data, space, size);
+  }
+  if (err < 0)
+    ring_buf_dma_ack(dma, 0U);
+  return err;
+}
+
+/*!
+ * \brief Starts a transfer in either direction.
+ * \param dma Asynchronous transfer.
+ * \param state Direction.
+ * \param data Linear block.
+ * \param size Number of bytes.
+ * \param empty Error number for nothing to claim.
+ * \returns 0 on success, otherwise a negative error number.
+ */
+static int ring_buf_dma_start(struct ring_buf_dma *dma,
+                              enum ring_buf_dma_state state, void *data,
+                              ring_buf_size_t size, int empty) {
+  if (dma->state != RING_BUF_DMA_IDLE)
+    return -EBUSY;
+  dma->state = state;
+  dma->data = data;
+  dma->size = size;
+  dma->count = 0U;
+  int err = ring_buf_dma_next(dma);
+  if (err < 0) {
+    dma->state = RING_BUF_DMA_IDLE;
+    return err == -EAGAIN ? empty : err;
+  }
+  return 0;
+}
+
+int ring_buf_dma_put(struct ring_buf_dma *dma, const void *data,
+                     ring_buf_size_t size) {
+  return ring_buf_dma_start(dma, RING_BUF_DMA_PUT, (void *)data, size,
+                            -EMSGSIZE);
+}
+
+int ring_buf_dma_get(struct ring_buf_dma *dma, void *data,
+                     ring_buf_size_t size) {
+  return ring_buf_dma_start(dma, RING_BUF_DMA_GET, data, size, -EAGAIN);
+}
+
+void ring_buf_dma_complete(struct ring_buf_dma *dma, int err) {
+  if (dma->state == RING_BUF_DMA_IDLE)
+    return;
+  if (err == 0) {
+    const ring_buf_size_t chunk = dma->chunk;
+    ring_buf_dma_ack(dma, chunk);
+    dma->data += chunk;
+    dma->size -= chunk;
+    dma->count += chunk;
+    if (dma->size) {
+      err = ring_buf_dma_next(dma);
+      if (err == 0)
+        return;
+      if (err == -EAGAIN)
+        err = 0;
+    }
+  } else
+    ring_buf_dma_ack(dma, 0U);
+  dma->state = RING_BUF_DMA_IDLE;
+  if (dma->done)
+    dma->done(dma, err < 0 ? err : (int)dma->count);
+}
+
+static int ring_buf_dma_memcpy_start(struct ring_buf_dma *dma, void *dst,
+                                     const void *src, ring_buf_size_t size) {
+  (void)memcpy(dst, src, size);
+  ring_buf_dma_complete(dma, 0);
+  return 0;
+}
+
+const struct ring_buf_dma_ops ring_buf_dma_memcpy = {
+    .start = ring_buf_dma_memcpy_start};
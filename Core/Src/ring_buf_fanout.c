@@ -0,0 +1,98 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: 2026, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+/*!
+ * \file ring_buf_fanout.c
+ * \brief Fan-out ring buffer functions.
+ * \details Implements independent reader zones over one ring buffer, with
+ * the slowest reader bounding the producer's free space.
+ * \copyright 2026, Roy Ratcliffe, Northumberland, United Kingdom
+ *
+ * Permission is hereby granted, free of charge,  to any person obtaining a
+ * copy  of  this  software  and    associated   documentation  files  (the
+ * "Software"), to deal in  the   Software  without  restriction, including
+ * without limitation the rights to  use,   copy,  modify,  merge, publish,
+ * distribute, sublicense, and/or sell  copies  of   the  Software,  and to
+ * permit persons to whom the Software is   furnished  to do so, subject to
+ * the following conditions:
+ *
+ *     The above copyright notice and this permission notice shall be
+ *     included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT  WARRANTY OF ANY KIND, EXPRESS
+ * OR  IMPLIED,  INCLUDING  BUT  NOT   LIMITED    TO   THE   WARRANTIES  OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR   PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS  OR   COPYRIGHT  HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER   IN  AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM,  OUT  OF   OR  IN  CONNECTION  WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "ring_buf_fanout.h"
+
+#include <stdint.h>
+
+/*!
+ * \brief Makes the underlying get zone follow the slowest reader.
+ * \details The reader furthest behind the put zone's tail has the most bytes
+ * outstanding. Copying its zone, less any open claim, into the underlying
+ * buffer's get zone bounds the producer's free space by that reader. Notifies
+ * a fall to the low watermark as the underlying get zone moves on.
+ * \param fanout Fan-out ring buffer.
+ */
+static void ring_buf_fanout_follow(struct ring_buf_fanout *fanout) {
+  struct ring_buf *buf = fanout->buf;
+  const struct ring_buf_zone *slowest = fanout->readers;
+  for (int reader = 1; reader < fanout->count; reader++)
+    if ((ring_buf_size_t)(buf->put.tail - fanout->readers[reader].tail) >
+        (ring_buf_size_t)(buf->put.tail - slowest->tail))
+      slowest = fanout->readers + reader;
+  const ring_buf_size_t before = buf->put.tail - buf->get.tail;
+  buf->get = *slowest;
+  buf->get.head = buf->get.tail;
+  RING_BUF_WATERMARK_NOTIFY(buf, before);
+}
+
+void ring_buf_fanout_reset(struct ring_buf_fanout *fanout, int reader) {
+  struct ring_buf_zone *zone = fanout->readers + reader;
+  zone->base = fanout->buf->put.base;
+  zone->head = zone->tail = fanout->buf->put.tail;
+  ring_buf_fanout_follow(fanout);
+}
+
+ring_buf_size_t ring_buf_fanout_used_space(const struct ring_buf_fanout *fanout,
+                                           int reader) {
+  return fanout->buf->put.tail - fanout->readers[reader].head;
+}
+
+ring_buf_size_t ring_buf_fanout_get_claim(struct ring_buf_fanout *fanout,
+                                          int reader, void **space,
+                                          ring_buf_size_t size) {
+  return ring_buf_zone_claim(fanout->buf, fanout->readers + reader, space,
+                             size, ring_buf_fanout_used_space(fanout, reader));
+}
+
+int ring_buf_fanout_get_ack(struct ring_buf_fanout *fanout, int reader,
+                            ring_buf_size_t size) {
+  int err = ring_buf_zone_ack(fanout->buf, fanout->readers + reader, size);
+  if (err < 0)
+    return err;
+  ring_buf_fanout_follow(fanout);
+  return 0;
+}
+
+int ring_buf_fanout_get_all(struct ring_buf_fanout *fanout, int reader,
+                            void *data, ring_buf_size_t size) {
+  if (size > ring_buf_fanout_used_space(fanout, reader))
+    return -EAGAIN;
+  ring_buf_size_t ack = 0U, claim;
+  do {
+    void *space;
+    claim = ring_buf_fanout_get_claim(fanout, reader, &space, size - ack);
+    if (data)
+      ring_buf_copy((uint8_t *)data + ack, space, claim);
+    ack += claim;
+  } while (claim && ack < size);
+  return ring_buf_fanout_get_ack(fanout, reader, ack);
+}
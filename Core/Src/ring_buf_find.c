@@ -0,0 +1,157 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: 2026, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+/*!
+ * \file ring_buf_find.c
+ * \brief Ring buffer search functions.
+ * \details Implements in-place searches over the used spans of a ring
+ * buffer.
+ * \copyright 2026, Roy Ratcliffe, Northumberland, United Kingdom
+ *
+ * Permission is hereby granted, free of charge,  to any person obtaining a
+ * copy  of  this  software  and    associated   documentation  files  (the
+ * "Software"), to deal in  the   Software  without  restriction, including
+ * without limitation the rights to  use,   copy,  modify,  merge, publish,
+ * distribute, sublicense, and/or sell  copies  of   the  Software,  and to
+ * permit persons to whom the Software is   furnished  to do so, subject to
+ * the following conditions:
+ *
+ *     The above copyright notice and this permission notice shall be
+ *     included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT  WARRANTY OF ANY KIND, EXPRESS
+ * OR  IMPLIED,  INCLUDING  BUT  NOT   LIMITED    TO   THE   WARRANTIES  OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR   PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS  OR   COPYRIGHT  HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER   IN  AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM,  OUT  OF   OR  IN  CONNECTION  WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "ring_buf_find.h"
+
+#include <string.h>
+
+/*!
+ * \brief Word type for scanning.
+ * \details May alias any other type, the same as a character type.
+ */
+typedef uint32_t __attribute__((__may_alias__)) ring_buf_find_word_t;
+
+/*!
+ * \brief Word with every byte set to one.
+ */
+#define RING_BUF_FIND_ONES ((ring_buf_find_word_t)0x01010101U)
+
+/*!
+ * \brief Word with every byte's top bit set.
+ */
+#define RING_BUF_FIND_HIGHS ((ring_buf_find_word_t)0x80808080U)
+
+/*!
+ * \brief Finds a byte within one contiguous span.
+ * \details Compares bytes up to the first word boundary, then whole words.
+ * Exclusive-or with the byte repeated four times turns matching bytes to
+ * zero; subtracting ones borrows through a zero byte's top bit, which the
+ * complement then isolates. Any non-zero result means a zero byte somewhere
+ * in the word, so the final byte loop finds it exactly. Nano newlib's
+ * \c memchr compares one byte at a time.
+ * \param space Address of the first byte.
+ * \param size Number of bytes.
+ * \param byte Byte to find.
+ * \returns Address of the first match, or \c NULL if none.
+ */
+static const uint8_t *ring_buf_find_span(const uint8_t *space,
+                                         ring_buf_size_t size, uint8_t byte) {
+  const uint8_t *end = space + size;
+  while (space < end &&
+         ((uintptr_t)space & (sizeof(ring_buf_find_word_t) - 1U)) != 0U) {
+    if (*space == byte)
+      return space;
+    space++;
+  }
+  const ring_buf_find_word_t repeat = RING_BUF_FIND_ONES * byte;
+  for (; (size_t)(end - space) >= sizeof(ring_buf_find_word_t);
+       space += sizeof(ring_buf_find_word_t)) {
+    const ring_buf_find_word_t word =
+        *(const ring_buf_find_word_t *)space ^ repeat;
+    if (((word - RING_BUF_FIND_ONES) & ~word & RING_BUF_FIND_HIGHS) != 0U)
+      break;
+  }
+  for (; space < end; space++)
+    if (*space == byte)
+      return space;
+  return NULL;
+}
+
+/*!
+ * \brief Finds a byte within a pair of spans.
+ * \param spans Array of two spans.
+ * \param byte Byte to find.
+ * \param offset Offset at which to start searching.
+ * \returns Offset of the first matching byte, or \c -EAGAIN if none.
+ */
+static ring_buf_ptrdiff_t
+ring_buf_find_spans(const struct ring_buf_span spans[2], uint8_t byte,
+                    ring_buf_size_t offset) {
+  ring_buf_size_t base = 0U;
+  for (int i = 0; i < 2; i++) {
+    const ring_buf_size_t size = spans[i].size;
+    if (offset < size) {
+      const uint8_t *space = spans[i].space;
+      const uint8_t *found = ring_buf_find_span(space + offset, size - offset,
+                                                byte);
+      if (found)
+        return base + (ring_buf_size_t)(found - space);
+      offset = 0U;
+    } else
+      offset -= size;
+    base += size;
+  }
+  return -EAGAIN;
+}
+
+/*!
+ * \brief Compares a pattern in place.
+ * \param spans Array of two spans.
+ * \param offset Offset of the candidate match.
+ * \param pattern Address of the pattern's bytes.
+ * \param length Number of bytes in the pattern, all within the spans.
+ * \returns \c true if the bytes at \p offset match the pattern.
+ */
+static bool ring_buf_find_match(const struct ring_buf_span spans[2],
+                                ring_buf_size_t offset, const uint8_t *pattern,
+                                ring_buf_size_t length) {
+  struct ring_buf_span slice[2];
+  ring_buf_span_slice(spans, offset, length, slice);
+  return memcmp(slice[0].space, pattern, slice[0].size) == 0 &&
+         memcmp(slice[1].space, pattern + slice[0].size, slice[1].size) == 0;
+}
+
+ring_buf_ptrdiff_t ring_buf_find_byte(const struct ring_buf *buf, uint8_t byte,
+                                      ring_buf_size_t offset) {
+  struct ring_buf_span spans[2];
+  (void)ring_buf_used_spans(buf, spans);
+  return ring_buf_find_spans(spans, byte, offset);
+}
+
+ring_buf_ptrdiff_t ring_buf_find_pattern(const struct ring_buf *buf,
+                                         const void *pattern,
+                                         ring_buf_size_t length,
+                                         ring_buf_size_t offset) {
+  struct ring_buf_span spans[2];
+  const ring_buf_size_t used = ring_buf_used_spans(buf, spans);
+  if (length == 0U)
+    return offset <= used ? (ring_buf_ptrdiff_t)offset : -EAGAIN;
+  const uint8_t *first = pattern;
+  while (offset < used && length <= used - offset) {
+    const ring_buf_ptrdiff_t found = ring_buf_find_spans(spans, *first, offset);
+    if (found < 0 || length > used - (ring_buf_size_t)found)
+      break;
+    if (ring_buf_find_match(spans, found, first, length))
+      return found;
+    offset = found + 1;
+  }
+  return -EAGAIN;
+}
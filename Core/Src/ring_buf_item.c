@@ -32,12 +32,17 @@
 
 #include "ring_buf_item.h"
 
+#include <stdint.h>
+
 int ring_buf_item_put(struct ring_buf *buf, const void *item,
                       ring_buf_item_length_t length) {
-  if (sizeof(length) + length > ring_buf_free_space(buf))
-    return -EMSGSIZE;
-  const ring_buf_size_t claim = ring_buf_put(buf, &length, sizeof(length));
-  return claim + ring_buf_put(buf, item, length);
+  /*
+   * Put the length prefix and the item in one vectored claim. The item itself
+   * is only read; the cast merely satisfies the I/O vector's type.
+   */
+  const struct ring_buf_iovec iov[] = {{&length, sizeof(length)},
+                                       {(void *)item, length}};
+  return ring_buf_putv(buf, iov, 2);
 }
 
 int ring_buf_item_get(struct ring_buf *buf, void *item,
@@ -47,3 +52,107 @@ int ring_buf_item_get(struct ring_buf *buf, void *item,
   const ring_buf_size_t claim = ring_buf_get(buf, length, sizeof(*length));
   return claim + ring_buf_get(buf, item, *length);
 }
+
+int ring_buf_item_peek_length(const struct ring_buf *buf,
+                              ring_buf_item_length_t *length) {
+  struct ring_buf_span used[2];
+  if (ring_buf_used_spans(buf, used) < sizeof(*length))
+    return -EAGAIN;
+  ring_buf_span_read(used, 0U, length, sizeof(*length));
+  return 0;
+}
+
+int ring_buf_item_peek(const struct ring_buf *buf, void *data,
+                       ring_buf_size_t size) {
+  ring_buf_item_length_t length;
+  struct ring_buf_span used[2];
+  if (ring_buf_used_spans(buf, used) < sizeof(length))
+    return -EAGAIN;
+  ring_buf_span_read(used, 0U, &length, sizeof(length));
+  if (size > length)
+    size = length;
+  ring_buf_span_read(used, sizeof(length), data, size);
+  return size;
+}
+
+int ring_buf_item_skip(struct ring_buf *buf) {
+  ring_buf_item_length_t length;
+  return ring_buf_item_get(buf, NULL, &length);
+}
+
+int ring_buf_item_yield(const struct ring_buf *buf,
+                        int yield(const struct ring_buf_span spans[2],
+                                  ring_buf_item_length_t length, int index,
+                                  void *extra),
+                        void *extra) {
+  struct ring_buf_span used[2];
+  const ring_buf_size_t size = ring_buf_used_spans(buf, used);
+  ring_buf_size_t offset = 0U;
+  int index = 0;
+  while ((ring_buf_size_t)(size - offset) >= sizeof(ring_buf_item_length_t)) {
+    ring_buf_item_length_t length;
+    ring_buf_span_read(used, offset, &length, sizeof(length));
+    offset += sizeof(length);
+    if (length > (ring_buf_size_t)(size - offset))
+      return -EBADMSG;
+    struct ring_buf_span spans[2];
+    ring_buf_span_slice(used, offset, length, spans);
+    offset += length;
+    int yielded = yield(spans, length, index, extra);
+    if (yielded != -EAGAIN)
+      return yielded;
+    index++;
+  }
+  return index;
+}
+
+int ring_buf_item_put_varint(struct ring_buf *buf, const void *item,
+                             uint32_t length) {
+  /*
+   * Refuse lengths beyond the buffer before narrowing to the size type.
+   */
+  if (length > buf->size)
+    return -EMSGSIZE;
+  uint8_t prefix[RING_BUF_ITEM_VARINT_MAX];
+  ring_buf_size_t size = 0U;
+  uint32_t remaining = length;
+  while (remaining >= 0x80U) {
+    prefix[size++] = (uint8_t)(remaining | 0x80U);
+    remaining >>= 7;
+  }
+  prefix[size++] = (uint8_t)remaining;
+  const struct ring_buf_iovec iov[] = {{prefix, size},
+                                       {(void *)item, (ring_buf_size_t)length}};
+  return ring_buf_putv(buf, iov, 2);
+}
+
+int ring_buf_item_get_varint(struct ring_buf *buf, void *item,
+                             uint32_t *length) {
+  struct ring_buf_span used[2];
+  const ring_buf_size_t size = ring_buf_used_spans(buf, used);
+  if (size == 0U)
+    return -EAGAIN;
+  /*
+   * Decode the prefix in place and claim nothing until the prefix and the
+   * whole item are there. The fifth byte carries the top four bits of the
+   * length and ends the prefix.
+   */
+  ring_buf_size_t prefix = 0U;
+  uint32_t value = 0U;
+  uint8_t byte;
+  do {
+    if (prefix == size)
+      return -EAGAIN;
+    ring_buf_span_read(used, prefix, &byte, sizeof(byte));
+    if (prefix == RING_BUF_ITEM_VARINT_MAX - 1U && byte > 0x0fU)
+      return -EBADMSG;
+    value |= (uint32_t)(byte & 0x7fU) << (7U * prefix++);
+  } while (byte & 0x80U);
+  if (value > (ring_buf_size_t)(buf->size - prefix))
+    return -EBADMSG;
+  if (value > (ring_buf_size_t)(size - prefix))
+    return -EAGAIN;
+  *length = value;
+  const ring_buf_size_t claim = ring_buf_get(buf, NULL, prefix);
+  return claim + ring_buf_get(buf, item, (ring_buf_size_t)value);
+}
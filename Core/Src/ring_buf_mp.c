@@ -0,0 +1,144 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: 2026, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+/*!
+ * \file ring_buf_mp.c
+ * \brief Multi-producer ring buffer functions.
+ * \details Implements compare-and-exchange reservation and in-order
+ * publication for several producers sharing one ring buffer.
+ * \copyright 2026, Roy Ratcliffe, Northumberland, United Kingdom
+ *
+ * Permission is hereby granted, free of charge,  to any person obtaining a
+ * copy  of  this  software  and    associated   documentation  files  (the
+ * "Software"), to deal in  the   Software  without  restriction, including
+ * without limitation the rights to  use,   copy,  modify,  merge, publish,
+ * distribute, sublicense, and/or sell  copies  of   the  Software,  and to
+ * permit persons to whom the Software is   furnished  to do so, subject to
+ * the following conditions:
+ *
+ *     The above copyright notice and this permission notice shall be
+ *     included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT  WARRANTY OF ANY KIND, EXPRESS
+ * OR  IMPLIED,  INCLUDING  BUT  NOT   LIMITED    TO   THE   WARRANTIES  OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR   PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS  OR   COPYRIGHT  HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER   IN  AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM,  OUT  OF   OR  IN  CONNECTION  WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "ring_buf_mp.h"
+
+#include <stdint.h>
+
+/*!
+ * \brief Offset of an index within the buffer space.
+ * \details The offset is the index relative to the put zone's base modulo the
+ * size. The base only ever moves forward by whole multiples of the size, and
+ * never past a reserved index, so an old or new base gives the same offset.
+ * \param buf Ring buffer.
+ * \param index Put index.
+ * \returns Offset less than the buffer size.
+ */
+static inline ring_buf_size_t ring_buf_mp_offset(const struct ring_buf *buf,
+                                                 ring_buf_ptrdiff_t index) {
+  const ring_buf_size_t offset =
+      index - __atomic_load_n(&buf->put.base, __ATOMIC_RELAXED);
+  return buf->mask ? offset & buf->mask : offset % buf->size;
+}
+
+/*!
+ * \brief Rebases the put zone behind a published head.
+ * \details Keeps the distance from base to index well within the index range
+ * so that the modulo in \c ring_buf_mp_offset stays exact however much data
+ * passes through. Masked offsets do not depend on the base; the size divides
+ * the index range.
+ * \param buf Ring buffer.
+ * \param head Published put index.
+ */
+static void ring_buf_mp_rebase(struct ring_buf *buf, ring_buf_ptrdiff_t head) {
+  if (buf->mask)
+    return;
+  ring_buf_ptrdiff_t base = __atomic_load_n(&buf->put.base, __ATOMIC_RELAXED);
+  const ring_buf_size_t behind = head - base;
+  const ring_buf_ptrdiff_t rebased = base + (behind - behind % buf->size);
+  while ((ring_buf_ptrdiff_t)(rebased - base) > 0 &&
+         !__atomic_compare_exchange_n(&buf->put.base, &base, rebased, true,
+                                      __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+    ;
+}
+
+int ring_buf_mp_put_claim(struct ring_buf_mp *mp, ring_buf_size_t size,
+                          struct ring_buf_span spans[2]) {
+  struct ring_buf *buf = mp->buf;
+  /*
+   * Count this producer in before reserving. Any producer that observes the
+   * advanced head afterwards must also observe a non-zero writer count until
+   * this producer commits.
+   */
+  (void)__atomic_add_fetch(&mp->writers, 1U, __ATOMIC_SEQ_CST);
+  ring_buf_ptrdiff_t head = __atomic_load_n(&buf->put.head, __ATOMIC_RELAXED);
+  do {
+    const ring_buf_ptrdiff_t tail =
+        __atomic_load_n(&buf->get.tail, __ATOMIC_ACQUIRE);
+    if (size > buf->size - (ring_buf_size_t)(head - tail))
+      return -EMSGSIZE;
+  } while (!__atomic_compare_exchange_n(&buf->put.head, &head, head + size,
+                                        true, __ATOMIC_SEQ_CST,
+                                        __ATOMIC_RELAXED));
+  const ring_buf_size_t offset = ring_buf_mp_offset(buf, head);
+  ring_buf_size_t first = buf->size - offset;
+  if (first > size)
+    first = size;
+  spans[0].space = (uint8_t *)buf->space + offset;
+  spans[0].size = first;
+  spans[1].space = buf->space;
+  spans[1].size = size - first;
+  return 0;
+}
+
+void ring_buf_mp_put_commit(struct ring_buf_mp *mp) {
+  struct ring_buf *buf = mp->buf;
+  if (__atomic_sub_fetch(&mp->writers, 1U, __ATOMIC_SEQ_CST) != 0U)
+    return;
+  /*
+   * No producer was mid-reservation a moment ago. Take the head, then check
+   * again: if another producer has since counted itself in, its reservation
+   * may lie below the head just taken and it will publish on commit instead.
+   */
+  const ring_buf_ptrdiff_t head =
+      __atomic_load_n(&buf->put.head, __ATOMIC_SEQ_CST);
+  if (__atomic_load_n(&mp->writers, __ATOMIC_SEQ_CST) != 0U)
+    return;
+  /*
+   * Only ever move the tail forwards. A producer preempted between here and
+   * its store would otherwise publish a stale head over a newer one.
+   */
+  ring_buf_ptrdiff_t tail = __atomic_load_n(&buf->put.tail, __ATOMIC_RELAXED);
+  while ((ring_buf_ptrdiff_t)(head - tail) > 0 &&
+         !__atomic_compare_exchange_n(&buf->put.tail, &tail, head, true,
+                                      __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+    ;
+  ring_buf_mp_rebase(buf, head);
+}
+
+int ring_buf_mp_putv(struct ring_buf_mp *mp, const struct ring_buf_iovec *iov,
+                     int iovcnt) {
+  ring_buf_size_t size = 0U;
+  for (int i = 0; i < iovcnt; i++)
+    size += iov[i].size;
+  struct ring_buf_span spans[2];
+  int err = ring_buf_mp_put_claim(mp, size, spans);
+  if (err == 0)
+    ring_buf_iovec_copy(spans, iov, iovcnt, true);
+  ring_buf_mp_put_commit(mp);
+  return err;
+}
+
+int ring_buf_mp_put(struct ring_buf_mp *mp, const void *data,
+                    ring_buf_size_t size) {
+  const struct ring_buf_iovec iov = {(void *)data, size};
+  return ring_buf_mp_putv(mp, &iov, 1);
+}
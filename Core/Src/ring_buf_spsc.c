@@ -0,0 +1,177 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: 2026, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+/*!
+ * \file ring_buf_spsc.c
+ * \brief Single-producer single-consumer ring buffer functions.
+ * \details Implements lock-free claim and acknowledge functions where the
+ * producer owns the put zone and the consumer owns the get zone.
+ * \copyright 2026, Roy Ratcliffe, Northumberland, United Kingdom
+ *
+ * Permission is hereby granted, free of charge,  to any person obtaining a
+ * copy  of  this  software  and    associated   documentation  files  (the
+ * "Software"), to deal in  the   Software  without  restriction, including
+ * without limitation the rights to  use,   copy,  modify,  merge, publish,
+ * distribute, sublicense, and/or sell  copies  of   the  Software,  and to
+ * permit persons to whom the Software is   furnished  to do so, subject to
+ * the following conditions:
+ *
+ *     The above copyright notice and this permission notice shall be
+ *     included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT  WARRANTY OF ANY KIND, EXPRESS
+ * OR  IMPLIED,  INCLUDING  BUT  NOT   LIMITED    TO   THE   WARRANTIES  OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR   PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS  OR   COPYRIGHT  HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER   IN  AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM,  OUT  OF   OR  IN  CONNECTION  WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "ring_buf_spsc.h"
+
+#include <stdint.h>
+
+/*
+ * The GCC atomic built-ins operate on plain objects, which leaves struct
+ * ring_buf unchanged for the non-concurrent functions. On Cortex-M4, an
+ * aligned word load or store is single-copy atomic; acquire and release add a
+ * data memory barrier and, just as importantly, stop the compiler from moving
+ * the data copies across the index updates.
+ */
+
+/*!
+ * \brief Loads the other side's tail index.
+ * \param tail Address of tail index.
+ * \returns Tail index.
+ */
+static inline ring_buf_ptrdiff_t
+ring_buf_spsc_load_tail(const ring_buf_ptrdiff_t *tail) {
+  return __atomic_load_n(tail, __ATOMIC_ACQUIRE);
+}
+
+/*!
+ * \brief Stores and publishes this side's tail index.
+ * \param tail Address of tail index.
+ * \param index New tail index.
+ */
+static inline void ring_buf_spsc_store_tail(ring_buf_ptrdiff_t *tail,
+                                            ring_buf_ptrdiff_t index) {
+  __atomic_store_n(tail, index, __ATOMIC_RELEASE);
+}
+
+/*!
+ * \brief Clamp a value to a specified limit.
+ * \param clamp Pointer to the value to clamp.
+ * \param limit The limit to clamp the value to.
+ */
+static inline void ring_buf_spsc_clamp(ring_buf_size_t *clamp,
+                                       ring_buf_size_t limit) {
+  if (*clamp > limit)
+    *clamp = limit;
+}
+
+/*!
+ * \brief Claims contiguous space within a zone.
+ * \details Shared by both sides. The zone belongs to the caller's side; \p
+ * limit is the used or free space computed from the other side's tail.
+ * \param buf Ring buffer.
+ * \param zone Zone to claim from, put or get.
+ * \param space Address of pointer to claimed space, or \c NULL to ignore.
+ * \param size Number of bytes to claim.
+ * \param limit Maximum number of bytes available.
+ * \returns Number of bytes claimed.
+ */
+static ring_buf_size_t ring_buf_spsc_claim(struct ring_buf *buf,
+                                           struct ring_buf_zone *zone,
+                                           void **space, ring_buf_size_t size,
+                                           ring_buf_size_t limit) {
+  ring_buf_size_t head = zone->head - zone->base;
+  if (head >= buf->size)
+    head -= buf->size;
+  ring_buf_spsc_clamp(&size, buf->size - head);
+  ring_buf_spsc_clamp(&size, limit);
+  if (space)
+    *space = (uint8_t *)buf->space + head;
+  zone->head += size;
+  return size;
+}
+
+/*!
+ * \brief Acknowledges claimed space within a zone and publishes its tail.
+ * \param buf Ring buffer.
+ * \param zone Zone to acknowledge, put or get.
+ * \param size Number of bytes to acknowledge.
+ * \retval 0 on success.
+ * \retval -EINVAL if \c size exceeds the claimed space.
+ */
+static int ring_buf_spsc_ack(struct ring_buf *buf, struct ring_buf_zone *zone,
+                             ring_buf_size_t size) {
+  ring_buf_size_t claim = zone->head - zone->tail;
+  if (size > claim)
+    return -EINVAL;
+  ring_buf_ptrdiff_t tail = zone->tail + size;
+  zone->head = tail;
+  if ((ring_buf_size_t)(tail - zone->base) >= buf->size)
+    zone->base += buf->size;
+  ring_buf_spsc_store_tail(&zone->tail, tail);
+  return 0;
+}
+
+ring_buf_size_t ring_buf_spsc_used_space(const struct ring_buf *buf) {
+  return ring_buf_spsc_load_tail(&buf->put.tail) - buf->get.head;
+}
+
+ring_buf_size_t ring_buf_spsc_free_space(const struct ring_buf *buf) {
+  return buf->size - (buf->put.head - ring_buf_spsc_load_tail(&buf->get.tail));
+}
+
+ring_buf_size_t ring_buf_spsc_put_claim(struct ring_buf *buf, void **space,
+                                        ring_buf_size_t size) {
+  return ring_buf_spsc_claim(buf, &buf->put, space, size,
+                             ring_buf_spsc_free_space(buf));
+}
+
+int ring_buf_spsc_put_ack(struct ring_buf *buf, ring_buf_size_t size) {
+  return ring_buf_spsc_ack(buf, &buf->put, size);
+}
+
+ring_buf_size_t ring_buf_spsc_get_claim(struct ring_buf *buf, void **space,
+                                        ring_buf_size_t size) {
+  return ring_buf_spsc_claim(buf, &buf->get, space, size,
+                             ring_buf_spsc_used_space(buf));
+}
+
+int ring_buf_spsc_get_ack(struct ring_buf *buf, ring_buf_size_t size) {
+  return ring_buf_spsc_ack(buf, &buf->get, size);
+}
+
+int ring_buf_spsc_put_all(struct ring_buf *buf, const void *data,
+                          ring_buf_size_t size) {
+  if (size > ring_buf_spsc_free_space(buf))
+    return -EMSGSIZE;
+  ring_buf_size_t ack = 0U, claim;
+  do {
+    void *space;
+    claim = ring_buf_spsc_put_claim(buf, &space, size - ack);
+    ring_buf_copy(space, (const uint8_t *)data + ack, claim);
+    ack += claim;
+  } while (claim && ack < size);
+  return ring_buf_spsc_put_ack(buf, ack);
+}
+
+int ring_buf_spsc_get_all(struct ring_buf *buf, void *data,
+                          ring_buf_size_t size) {
+  if (size > ring_buf_spsc_used_space(buf))
+    return -EAGAIN;
+  ring_buf_size_t ack = 0U, claim;
+  do {
+    void *space;
+    claim = ring_buf_spsc_get_claim(buf, &space, size - ack);
+    if (data)
+      ring_buf_copy((uint8_t *)data + ack, space, claim);
+    ack += claim;
+  } while (claim && ack < size);
+  return ring_buf_spsc_get_ack(buf, ack);
+}
@@ -0,0 +1,178 @@
+/*
+ * SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: 2026, Roy Ratcliffe, Northumberland, United Kingdom
+ */
+/*!
+ * \file ring_buf_ts.c
+ * \brief Timestamped ring buffer record functions.
+ * \details Implements timestamped records over ring buffer items with a
+ * fixed-size index for binary search by time.
+ * \copyright 2026, Roy Ratcliffe, Northumberland, United Kingdom
+ *
+ * Permission is hereby granted, free of charge,  to any person obtaining a
+ * copy  of  this  software  and    associated   documentation  files  (the
+ * "Software"), to deal in  the   Software  without  restriction, including
+ * without limitation the rights to  use,   copy,  modify,  merge, publish,
+ * distribute, sublicense, and/or sell  copies  of   the  Software,  and to
+ * permit persons to whom the Software is   furnished  to do so, subject to
+ * the following conditions:
+ *
+ *     The above copyright notice and this permission notice shall be
+ *     included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT  WARRANTY OF ANY KIND, EXPRESS
+ * OR  IMPLIED,  INCLUDING  BUT  NOT   LIMITED    TO   THE   WARRANTIES  OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR   PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS  OR   COPYRIGHT  HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY,  WHETHER   IN  AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM,  OUT  OF   OR  IN  CONNECTION  WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "ring_buf_ts.h"
+
+#ifdef __arm__
+#include "stm32f4xx.h"
+#else
+#include <time.h>
+#endif
+
+RING_BUF_TYPE_DEFINE(ring_buf_ts_index, struct ring_buf_ts_entry)
+
+#ifdef RING_BUF_TS_64
+ring_buf_ts_t ring_buf_ts_extend(struct ring_buf_ts_counter *counter) {
+#ifdef __arm__
+  const uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+#endif
+  const uint32_t count = *counter->count;
+  if (count < counter->last)
+    counter->wraps++;
+  counter->last = count;
+  const ring_buf_ts_t ts = (ring_buf_ts_t)counter->wraps << 32 | count;
+#ifdef __arm__
+  __set_PRIMASK(primask);
+#endif
+  return ts;
+}
+#endif
+
+__attribute__((weak)) ring_buf_ts_t ring_buf_ts_clock(void) {
+#if defined(__arm__) && defined(RING_BUF_TS_64)
+  static struct ring_buf_ts_counter cycles = {.count = &DWT->CYCCNT};
+  return ring_buf_ts_extend(&cycles);
+#elif defined(__arm__)
+  return DWT->CYCCNT;
+#else
+  struct timespec now;
+  (void)clock_gettime(CLOCK_MONOTONIC, &now);
+  return (ring_buf_ts_t)now.tv_sec * 1000000000U + now.tv_nsec;
+#endif
+}
+
+/*!
+ * \brief Index entry of a record.
+ * \details The index's storage holds whole, aligned entries, so the entry
+ * looked back to from the newest lies in one piece.
+ * \param ts Timestamped ring buffer.
+ * \param index Zero-based record index, oldest first.
+ * \returns Address of the index entry.
+ */
+static const struct ring_buf_ts_entry *
+ring_buf_ts_entry(const struct ring_buf_ts *ts, ring_buf_size_t index) {
+  const ring_buf_size_t count = ring_buf_ts_count(ts);
+  return ring_buf_ts_index_at(ts->index, -(ring_buf_ptrdiff_t)(count - index));
+}
+
+ring_buf_size_t ring_buf_ts_count(const struct ring_buf_ts *ts) {
+  return ring_buf_ts_index_used_space(ts->index);
+}
+
+int ring_buf_ts_put(struct ring_buf_ts *ts, ring_buf_ts_t timestamp,
+                    const void *data, ring_buf_item_length_t length) {
+  if (ring_buf_ts_index_free_space(ts->index) == 0U)
+    return -EMSGSIZE;
+  const struct ring_buf_ts_entry entry = {.ts = timestamp,
+                                          .position = ts->buf->put.tail};
+  int ack = ring_buf_item_put(ts->buf, data, length);
+  if (ack < 0)
+    return ack;
+  (void)ring_buf_put_ack(ts->buf, ack);
+  return ring_buf_ts_index_put_all(ts->index, &entry, 1U);
+}
+
+int ring_buf_ts_put_circ(struct ring_buf_ts *ts, ring_buf_ts_t timestamp,
+                         const void *data, ring_buf_item_length_t length) {
+  /*
+   * Dropping records cannot make room for a record larger than the whole
+   * buffer, or make room in an index without capacity.
+   */
+  if (sizeof(ring_buf_item_length_t) + length > ts->buf->size ||
+      ts->index->size < sizeof(struct ring_buf_ts_entry))
+    return -EMSGSIZE;
+  int err;
+  while ((err = ring_buf_ts_put(ts, timestamp, data, length)) == -EMSGSIZE &&
+         ring_buf_ts_get(ts, NULL, NULL, NULL) == 0)
+    ;
+  return err;
+}
+
+int ring_buf_ts_get(struct ring_buf_ts *ts, ring_buf_ts_t *timestamp,
+                    void *data, ring_buf_item_length_t *length) {
+  struct ring_buf_ts_entry entry;
+  if (ring_buf_ts_index_get_all(ts->index, &entry, 1U) < 0)
+    return -EAGAIN;
+  ring_buf_item_length_t got;
+  (void)ring_buf_get_ack(ts->buf, ring_buf_item_get(ts->buf, data, &got));
+  if (timestamp)
+    *timestamp = entry.ts;
+  if (length)
+    *length = got;
+  return 0;
+}
+
+ring_buf_size_t ring_buf_ts_lower_bound(const struct ring_buf_ts *ts,
+                                        ring_buf_ts_t timestamp) {
+  ring_buf_size_t lower = 0U, upper = ring_buf_ts_count(ts);
+  while (lower < upper) {
+    const ring_buf_size_t middle = lower + (upper - lower) / 2U;
+    const ring_buf_ts_t at = ring_buf_ts_entry(ts, middle)->ts;
+    if ((ring_buf_ts_diff_t)(at - timestamp) < 0)
+      lower = middle + 1U;
+    else
+      upper = middle;
+  }
+  return lower;
+}
+
+int ring_buf_ts_yield(const struct ring_buf_ts *ts, ring_buf_ts_t t0,
+                      ring_buf_ts_t t1,
+                      int yield(const struct ring_buf_span spans[2],
+                                ring_buf_item_length_t length,
+                                ring_buf_ts_t timestamp, int index,
+                                void *extra),
+                      void *extra) {
+  const ring_buf_size_t count = ring_buf_ts_count(ts);
+  int index = 0;
+  for (ring_buf_size_t record = ring_buf_ts_lower_bound(ts, t0);
+       record < count; record++) {
+    const struct ring_buf_ts_entry *entry = ring_buf_ts_entry(ts, record);
+    if ((ring_buf_ts_diff_t)(entry->ts - t1) >= 0)
+      break;
+    /*
+     * The window from the record's position to the newest byte starts with
+     * the record's length prefix.
+     */
+    struct ring_buf_span window[2], spans[2];
+    (void)ring_buf_window_spans(ts->buf, ts->buf->put.tail - entry->position,
+                                window);
+    ring_buf_item_length_t length;
+    ring_buf_span_read(window, 0U, &length, sizeof(length));
+    ring_buf_span_slice(window, sizeof(length), length, spans);
+    int yielded = yield(spans, length, entry->ts, index, extra);
+    if (yielded != -EAGAIN)
+      return yielded;
+    index++;
+  }
+  return index;
+}
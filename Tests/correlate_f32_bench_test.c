@@ -0,0 +1,127 @@
+#include "arm_math.h"
+#include "correlate_f32.h"
+#include "cycles.h"
+#include "monitor_handles.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <unistd.h>
+
+CORRELATE_F32_DEFINE_STATIC_FFT(bench_corr, 1024);
+
+/*
+ * Load a noisy copy of a pseudo-random expected signal, delayed by a known
+ * number of samples, as the actual signal.
+ */
+static void bench_load(size_t len, size_t delay) {
+  static float32_t signal[1024 + 64];
+  uint32_t seed = 1U;
+  for (size_t i = 0; i < len + delay; i++) {
+    seed = seed * 1103515245U + 12345U;
+    signal[i] = (float32_t)(seed >> 8) / (float32_t)(1U << 23) - 1.0F;
+  }
+  ring_buf_reset(bench_corr.buf_expected, 0);
+  ring_buf_reset(bench_corr.buf_actual, 0);
+  assert(correlate_add_expected_block_f32(&bench_corr, signal + delay, len) == 0);
+  assert(correlate_add_actual_block_f32(&bench_corr, signal, len) == 0);
+}
+
+/*
+ * Time direct and FFT correlation over the window sizes in use. Both must
+ * find the same peak lag.
+ */
+int correlate_f32_bench(void) {
+  static const size_t lens[] = {32U, 64U, 100U, 128U, 256U, 512U, 1024U};
+  (void)printf("Correlation length, direct, FFT (cycles)\n");
+  for (size_t i = 0; i < sizeof(lens) / sizeof(lens[0]); i++) {
+    bench_load(lens[i], 10U);
+    uint32_t start = cycles();
+    int err = correlate_direct_f32(&bench_corr);
+    const uint32_t direct = cycles() - start;
+    assert(err == 0);
+    const int32_t direct_lag = correlate_peak_lag_f32(&bench_corr, NULL);
+    start = cycles();
+    err = correlate_fft_f32(&bench_corr);
+    const uint32_t fft = cycles() - start;
+    assert(err == 0);
+    const int32_t fft_lag = correlate_peak_lag_f32(&bench_corr, NULL);
+    assert(direct_lag == fft_lag);
+    (void)printf("  %4lu %10lu %10lu\n", (unsigned long)lens[i], (unsigned long)direct,
+                 (unsigned long)fft);
+  }
+  return 0;
+}
+
+CORRELATE_F32_DEFINE_STATIC_STREAM(bench_stream, 256);
+
+/*
+ * Time adding a sample pair to full buffers with running lag sums and reading
+ * out the result, against direct correlation from scratch.
+ */
+int correlate_stream_f32_bench(void) {
+  uint32_t seed = 1U;
+  for (size_t i = 0; i < 256U; i++) {
+    seed = seed * 1103515245U + 12345U;
+    const float32_t sample = (float32_t)(seed >> 8) / (float32_t)(1U << 23) - 1.0F;
+    assert(correlate_add_expected_f32(&bench_stream, sample) == 0);
+    assert(correlate_add_actual_f32(&bench_stream, sample) == 0);
+  }
+  uint32_t start = cycles();
+  int err = correlate_add_expected_f32(&bench_stream, 0.5F);
+  err |= correlate_add_actual_f32(&bench_stream, 0.5F);
+  err |= correlate_stream_f32(&bench_stream);
+  const uint32_t stream = cycles() - start;
+  assert(err == 0);
+  start = cycles();
+  err = correlate_direct_f32(&bench_stream);
+  const uint32_t direct = cycles() - start;
+  assert(err == 0);
+  (void)printf("Sample pair into 256 samples, streaming: %lu cycles, direct: %lu cycles\n",
+               (unsigned long)stream, (unsigned long)direct);
+  return 0;
+}
+
+CORRELATE_F32_DEFINE_STATIC(bench_copied, 256);
+CORRELATE_F32_DEFINE_STATIC_IN_PLACE(bench_in_place, 256);
+
+/*
+ * Time direct correlation of wrapped buffers, copying out to linear arrays
+ * against working in place on the spans.
+ */
+int correlate_in_place_f32_bench(void) {
+  uint32_t seed = 1U;
+  for (size_t i = 0; i < 300U; i++) {
+    seed = seed * 1103515245U + 12345U;
+    const float32_t sample = (float32_t)(seed >> 8) / (float32_t)(1U << 23) - 1.0F;
+    assert(correlate_add_expected_f32(&bench_copied, sample) == 0);
+    assert(correlate_add_actual_f32(&bench_copied, sample) == 0);
+    assert(correlate_add_expected_f32(&bench_in_place, sample) == 0);
+    assert(correlate_add_actual_f32(&bench_in_place, sample) == 0);
+  }
+  uint32_t start = cycles();
+  int err = correlate_direct_f32(&bench_copied);
+  const uint32_t copied = cycles() - start;
+  assert(err == 0);
+  start = cycles();
+  err = correlate_direct_f32(&bench_in_place);
+  const uint32_t in_place = cycles() - start;
+  assert(err == 0);
+  assert(correlate_peak_lag_f32(&bench_copied, NULL) ==
+         correlate_peak_lag_f32(&bench_in_place, NULL));
+  (void)printf("Wrapped 256 samples, copied: %lu cycles, in place: %lu cycles\n",
+               (unsigned long)copied, (unsigned long)in_place);
+  return 0;
+}
+
+int main(void) {
+  initialise_monitor_handles();
+  (void)printf("Hello, World from %s!!!\n", "correlate_f32_bench_test");
+  cycles_init();
+
+  assert(correlate_f32_bench() == 0);
+  assert(correlate_stream_f32_bench() == 0);
+  assert(correlate_in_place_f32_bench() == 0);
+
+  _exit(0);
+  return 0;
+}
@@ -5,6 +5,7 @@
 #include "monitor_handles.h"
 
 #include <assert.h>
+#include <errno.h>
 #include <stdio.h>
 #include <unistd.h>
 
@@ -86,11 +87,200 @@ int correlate_f32_test(void) {
   return 0;
 }
 
+CORRELATE_F32_DEFINE_STATIC(test_block, 4);
+
+/*
+ * Adding blocks must leave the same data as adding sample by sample, and an
+ * oversized block must keep only its newest samples.
+ */
+int correlate_block_f32_test(void) {
+  assert(correlate_add_expected_block_f32(&test_block, x, sizeof(x) / sizeof(x[0])) == 0);
+  assert(correlate_add_actual_block_f32(&test_block, h, sizeof(h) / sizeof(h[0])) == 0);
+  assert(correlate_add_actual_block_f32(&test_block, x, 2U) == 0);
+  assert(correlate_f32(&test_block) == 0);
+
+  float32_t *expected, *actual;
+  assert(correlate_get_expected_f32(&test_block, &expected) == 4U);
+  for (size_t i = 0; i < 4U; i++) {
+    assert(expected[i] == x[2U + i]);
+  }
+  assert(correlate_get_actual_f32(&test_block, &actual) == 4U);
+  assert(actual[0] == h[1] && actual[1] == h[2]);
+  assert(actual[2] == x[0] && actual[3] == x[1]);
+  return 0;
+}
+
+CORRELATE_F32_DEFINE_STATIC_FFT(test_fft, 200);
+
+/*
+ * Load pseudo-random samples between -1 and 1, then correlate directly and by
+ * FFT. Both must write the same elements with the same values to within
+ * rounding, leaving the same elements unwritten.
+ */
+static void test_fft_check(size_t expected_len, size_t actual_len, uint32_t *seed) {
+  ring_buf_reset(test_fft.buf_expected, 0);
+  ring_buf_reset(test_fft.buf_actual, 0);
+  for (size_t i = 0; i < expected_len + actual_len; i++) {
+    *seed = *seed * 1103515245U + 12345U;
+    const float32_t sample = (float32_t)(*seed >> 8) / (float32_t)(1U << 23) - 1.0F;
+    if (i < expected_len) {
+      assert(correlate_add_expected_f32(&test_fft, sample) == 0);
+    } else {
+      assert(correlate_add_actual_f32(&test_fft, sample) == 0);
+    }
+  }
+  static float32_t direct[200 + 200 - 1];
+  const size_t len = sizeof(direct) / sizeof(direct[0]);
+  arm_fill_f32(-1000.0F, test_fft.correlated, len);
+  assert(correlate_direct_f32(&test_fft) == 0);
+  arm_copy_f32(test_fft.correlated, direct, len);
+  const int32_t peak_lag = correlate_peak_lag_f32(&test_fft, NULL);
+  arm_fill_f32(-1000.0F, test_fft.correlated, len);
+  assert(correlate_fft_f32(&test_fft) == 0);
+  assert(test_fft.correlated_len == expected_len + actual_len - 1U);
+  for (size_t i = 0; i < len; i++) {
+    assert(fabsf(test_fft.correlated[i] - direct[i]) < 1e-3F);
+  }
+  assert(correlate_peak_lag_f32(&test_fft, NULL) == peak_lag);
+}
+
+int correlate_fft_f32_test(void) {
+  uint32_t seed = 1U;
+  static const size_t lens[][2] = {{200U, 200U}, {200U, 57U}, {31U, 200U}, {1U, 1U},
+                                   {1U, 200U},   {129U, 2U}, {64U, 65U}};
+  for (size_t i = 0; i < sizeof(lens) / sizeof(lens[0]); i++) {
+    test_fft_check(lens[i][0], lens[i][1], &seed);
+  }
+
+  /*
+   * Without scratch space there is no FFT mode, but automatic correlation
+   * still succeeds directly.
+   */
+  assert(correlate_fft_f32(&test_corr) == -ENOMEM);
+  assert(correlate_f32(&test_corr) == 0);
+  ring_buf_reset(test_fft.buf_expected, 0);
+  assert(correlate_fft_f32(&test_fft) == -EINVAL);
+  return 0;
+}
+
+CORRELATE_F32_DEFINE_STATIC_STREAM(test_stream, 50);
+
+/*
+ * Running lag sums must match direct correlation after every kind of add: one
+ * stream faster than the other, both filling and both full, single samples
+ * and blocks, including blocks longer than the buffers.
+ */
+static void test_stream_check(void) {
+  static float32_t direct[50 + 50 - 1];
+  const size_t len = sizeof(direct) / sizeof(direct[0]);
+  arm_fill_f32(-1000.0F, test_stream.correlated, len);
+  if (correlate_direct_f32(&test_stream) == -EINVAL) {
+    assert(correlate_f32(&test_stream) == -EINVAL);
+    return;
+  }
+  arm_copy_f32(test_stream.correlated, direct, len);
+  arm_fill_f32(-1000.0F, test_stream.correlated, len);
+  assert(correlate_f32(&test_stream) == 0);
+  for (size_t i = 0; i < len; i++) {
+    assert(fabsf(test_stream.correlated[i] - direct[i]) < 1e-3F);
+  }
+}
+
+int correlate_stream_f32_test(void) {
+  assert(correlate_stream_f32(&test_corr) == -ENOMEM);
+  assert(correlate_stream_f32(&test_stream) == -EINVAL);
+  uint32_t seed = 2U;
+  for (size_t round = 0; round < 400U; round++) {
+    seed = seed * 1103515245U + 12345U;
+    const float32_t sample = (float32_t)(seed >> 8) / (float32_t)(1U << 23) - 1.0F;
+    if (round % 5U < 3U || round > 200U) {
+      assert(correlate_add_expected_f32(&test_stream, sample) == 0);
+    }
+    if (round % 5U >= 3U || round > 100U) {
+      assert(correlate_add_actual_f32(&test_stream, -sample) == 0);
+    }
+    if (round % 7U == 0U) {
+      test_stream_check();
+    }
+  }
+  test_stream_check();
+  static float32_t block[70];
+  for (size_t i = 0; i < sizeof(block) / sizeof(block[0]); i++) {
+    block[i] = (float32_t)(i % 9U) - 4.0F;
+  }
+  assert(correlate_add_expected_block_f32(&test_stream, block, 13U) == 0);
+  test_stream_check();
+  assert(correlate_add_actual_block_f32(&test_stream, block, 70U) == 0);
+  test_stream_check();
+
+  /*
+   * Resynchronising after resetting a buffer behind the instance's back.
+   */
+  ring_buf_reset(test_stream.buf_actual, 0);
+  assert(correlate_stream_sync_f32(&test_stream) == 0);
+  assert(correlate_stream_f32(&test_stream) == -EINVAL);
+  assert(correlate_add_actual_block_f32(&test_stream, block + 5, 20U) == 0);
+  test_stream_check();
+  assert(correlate_stream_sync_f32(&test_stream) == 0);
+  test_stream_check();
+  return 0;
+}
+
+CORRELATE_F32_DEFINE_STATIC(test_copied, 60);
+CORRELATE_F32_DEFINE_STATIC_IN_PLACE(test_in_place, 60);
+
+/*
+ * Correlating in place on wrapped spans must match correlating the linear
+ * copies, for every combination of lengths and wrap points, before and after
+ * normalising.
+ */
+int correlate_in_place_f32_test(void) {
+  uint32_t seed = 3U;
+  assert(correlate_add_expected_f32(&test_copied, 1.0F) == 0);
+  assert(correlate_add_expected_f32(&test_in_place, 1.0F) == 0);
+  assert(correlate_add_actual_f32(&test_copied, 1.0F) == 0);
+  assert(correlate_add_actual_f32(&test_in_place, 1.0F) == 0);
+  for (size_t round = 0; round < 150U; round++) {
+    seed = seed * 1103515245U + 12345U;
+    const float32_t sample = (float32_t)(seed >> 8) / (float32_t)(1U << 23) - 1.0F;
+    if (round % 3U != 0U) {
+      assert(correlate_add_expected_f32(&test_copied, sample) == 0);
+      assert(correlate_add_expected_f32(&test_in_place, sample) == 0);
+    }
+    if (round % 4U != 0U) {
+      assert(correlate_add_actual_f32(&test_copied, sample * 0.5F) == 0);
+      assert(correlate_add_actual_f32(&test_in_place, sample * 0.5F) == 0);
+    }
+    assert(correlate_f32(&test_copied) == 0);
+    assert(correlate_f32(&test_in_place) == 0);
+    const size_t len = correlate_get_correlated_f32(&test_copied, NULL);
+    assert(correlate_get_correlated_f32(&test_in_place, NULL) == len);
+    /*
+     * Longer expected data leaves the leading elements unwritten.
+     */
+    const size_t expected_len = correlate_get_expected_f32(&test_copied, NULL);
+    const size_t actual_len = correlate_get_actual_f32(&test_copied, NULL);
+    const size_t first = expected_len > actual_len ? expected_len - actual_len : 0U;
+    assert(correlate_normalise_f32(&test_copied) == 0);
+    assert(correlate_normalise_f32(&test_in_place) == 0);
+    for (size_t i = first; i < first + len; i++) {
+      assert(fabsf(test_in_place.correlated[i] - test_copied.correlated[i]) < 1e-5F);
+    }
+  }
+  float32_t *expected;
+  assert(correlate_get_expected_f32(&test_in_place, &expected) == 60U && expected == NULL);
+  return 0;
+}
+
 int main(void) {
   initialise_monitor_handles();
   (void)printf("Hello, World from %s!!!\n", "correlate_f32_test");
 
   assert(correlate_f32_test() == 0);
+  assert(correlate_block_f32_test() == 0);
+  assert(correlate_fft_f32_test() == 0);
+  assert(correlate_stream_f32_test() == 0);
+  assert(correlate_in_place_f32_test() == 0);
 
   _exit(0);
   return 0;
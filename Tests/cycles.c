@@ -0,0 +1,30 @@
+#include "cycles.h"
+
+#include "stm32f4xx.h"
+
+/*
+ * Number of SysTick reloads. Each reload spans 2^24 cycles.
+ */
+static volatile uint32_t cycles_reloads;
+
+void SysTick_Handler(void) { cycles_reloads++; }
+
+void cycles_init(void) {
+  SysTick->LOAD = SysTick_LOAD_RELOAD_Msk;
+  SysTick->VAL = 0U;
+  SysTick->CTRL =
+      SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk;
+}
+
+uint32_t cycles(void) {
+  /*
+   * Read the reload count either side of the counter value. Retry if a reload
+   * interrupt lands in between.
+   */
+  uint32_t reloads, val;
+  do {
+    reloads = cycles_reloads;
+    val = SysTick->VAL;
+  } while (reloads != cycles_reloads);
+  return (reloads << 24) + (SysTick_LOAD_RELOAD_Msk - val);
+}
@@ -0,0 +1,27 @@
+/* SPDX-License-Identifier: MIT */
+/*!
+ * \file cycles.h
+ * \brief Processor cycle counter for benchmarks.
+ * \details Counts processor cycles using SysTick as a free-running 24-bit
+ * down-counter, extended to 32 bits by counting reloads. QEMU does not model
+ * the DWT cycle counter but does model SysTick. Under emulation, the count
+ * follows the emulated clock rather than real pipeline timing, so compare
+ * results relative to each other rather than as absolute cycle costs.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/*!
+ * \brief Start the cycle counter.
+ * \details Takes over SysTick and its interrupt handler.
+ */
+void cycles_init(void);
+
+/*!
+ * \brief Read the cycle counter.
+ * \return Elapsed processor cycles since \c cycles_init(), modulo 2^32.
+ * \note Subtract two readings to measure an interval.
+ */
+uint32_t cycles(void);
@@ -0,0 +1,176 @@
+#include "ring_buf.h"
+#include "ring_buf_crc.h"
+#include "ring_buf_find.h"
+#include "cycles.h"
+#include "monitor_handles.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+/*
+ * Same size for both buffers. Only the mask differs, so the comparison
+ * isolates the generic rebasing path from the masked path.
+ */
+RING_BUF_DEFINE_STATIC(bench_generic, 256);
+RING_BUF_DEFINE_STATIC_POW2(bench_pow2, 256);
+
+#define BENCH_ROUNDS 10000U
+
+/*
+ * Run claim/ack round trips of an odd size so that claims regularly clamp at
+ * the end of the buffer space and zones rebase.
+ * Answers the number of cycles taken.
+ */
+static uint32_t bench_claim_ack(struct ring_buf *buf) {
+  const uint32_t start = cycles();
+  for (uint32_t round = 0U; round < BENCH_ROUNDS; round++) {
+    void *space;
+    ring_buf_size_t claim = ring_buf_put_claim(buf, &space, 13U);
+    (void)ring_buf_put_ack(buf, claim);
+    claim = ring_buf_get_claim(buf, &space, 13U);
+    (void)ring_buf_get_ack(buf, claim);
+  }
+  return cycles() - start;
+}
+
+int ring_buf_pow2_bench(void) {
+  /*
+   * Both paths must agree on where the zones end up.
+   */
+  const uint32_t generic = bench_claim_ack(&bench_generic);
+  const uint32_t pow2 = bench_claim_ack(&bench_pow2);
+  assert(bench_generic.put.tail == bench_pow2.put.tail);
+  assert(bench_generic.get.tail == bench_pow2.get.tail);
+  assert(ring_buf_is_empty(&bench_generic) && ring_buf_is_empty(&bench_pow2));
+
+  (void)printf("Claim/ack round trip, generic: %lu cycles per %lu rounds\n",
+               (unsigned long)generic, (unsigned long)BENCH_ROUNDS);
+  (void)printf("Claim/ack round trip, pow2:    %lu cycles per %lu rounds\n",
+               (unsigned long)pow2, (unsigned long)BENCH_ROUNDS);
+  return 0;
+}
+
+/*
+ * Copy benchmark buffer and word-aligned source and destination data.
+ */
+RING_BUF_DEFINE_STATIC(bench_copy, 8192);
+static uint32_t bench_src[4096 / sizeof(uint32_t)];
+static uint32_t bench_dst[4096 / sizeof(uint32_t)];
+
+/*
+ * Answers bytes per thousand cycles; nano newlib cannot print floats.
+ */
+static unsigned long bench_bytes_per_kcycle(uint32_t bytes, uint32_t elapsed) {
+  return (unsigned long)(1000ULL * bytes / (elapsed ? elapsed : 1U));
+}
+
+int ring_buf_copy_bench(void) {
+  static const ring_buf_size_t sizes[] = {4U, 64U, 512U, 4096U};
+  for (size_t i = 0; i < sizeof(bench_src); i++)
+    ((uint8_t *)bench_src)[i] = (uint8_t)i;
+  (void)printf("Transfer size, memcpy, ring_buf put+get (bytes per kilocycle)\n");
+  for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+    const ring_buf_size_t size = sizes[i];
+    const uint32_t rounds = 65536U / size;
+
+    /*
+     * Baseline. Two plain copies per round, one in and one out, the same as
+     * a ring buffer put followed by a get.
+     */
+    uint32_t start = cycles();
+    for (uint32_t round = 0U; round < rounds; round++) {
+      (void)memcpy(bench_dst, bench_src, size);
+      (void)memcpy(bench_src, bench_dst, size);
+    }
+    const uint32_t baseline = cycles() - start;
+
+    int err = 0;
+    start = cycles();
+    for (uint32_t round = 0U; round < rounds; round++) {
+      err |= ring_buf_put_all(&bench_copy, bench_src, size);
+      err |= ring_buf_get_all(&bench_copy, bench_dst, size);
+    }
+    const uint32_t copied = cycles() - start;
+    assert(err == 0);
+    assert(memcmp(bench_dst, bench_src, size) == 0);
+
+    const uint32_t bytes = 2U * size * rounds;
+    (void)printf("  %4lu %8lu %8lu\n", (unsigned long)size,
+                 bench_bytes_per_kcycle(bytes, baseline),
+                 bench_bytes_per_kcycle(bytes, copied));
+  }
+  return 0;
+}
+
+int ring_buf_find_bench(void) {
+  /*
+   * A line of 4095 bytes ending in a delimiter, wrapping in the buffer.
+   */
+  const ring_buf_size_t size = sizeof(bench_src);
+  (void)memset(bench_src, 'a', size - 1U);
+  ((uint8_t *)bench_src)[size - 1U] = '\n';
+  ring_buf_reset(&bench_copy, 0);
+  assert(ring_buf_put_all(&bench_copy, bench_src, 6000U) == 0);
+  assert(ring_buf_get_all(&bench_copy, NULL, 6000U) == 0);
+  assert(ring_buf_put_all(&bench_copy, bench_src, size) == 0);
+
+  uint32_t start = cycles();
+  const void *found = memchr(bench_src, '\n', size);
+  const uint32_t baseline = cycles() - start;
+  assert(found == (const uint8_t *)bench_src + size - 1U);
+
+  start = cycles();
+  const ring_buf_ptrdiff_t offset = ring_buf_find_byte(&bench_copy, '\n', 0U);
+  const uint32_t scanned = cycles() - start;
+  assert(offset == (ring_buf_ptrdiff_t)(size - 1U));
+
+  (void)printf("Find byte in %lu bytes, memchr: %lu cycles, ring_buf: %lu "
+               "cycles\n",
+               (unsigned long)size, (unsigned long)baseline,
+               (unsigned long)scanned);
+  return 0;
+}
+
+int ring_buf_crc_bench(void) {
+  const ring_buf_size_t size = sizeof(bench_src);
+  uint32_t start = cycles();
+  const uint32_t crc = ring_buf_crc32_sw(RING_BUF_CRC32_INIT, bench_src, size);
+  const uint32_t software = cycles() - start;
+  (void)printf("CRC-32 of %lu bytes, software: %lu bytes per kilocycle\n",
+               (unsigned long)size, bench_bytes_per_kcycle(size, software));
+#ifdef RING_BUF_CRC_HW
+  /*
+   * Emulators may leave the peripheral out, reading back zeros.
+   */
+  if (ring_buf_crc32_hw(RING_BUF_CRC32_INIT, "123456789", 9U) != 0x0376e6e7U) {
+    (void)printf("CRC-32 hardware: no CRC peripheral\n");
+    return 0;
+  }
+  start = cycles();
+  const uint32_t crc_hw =
+      ring_buf_crc32_hw(RING_BUF_CRC32_INIT, bench_src, size);
+  const uint32_t hardware = cycles() - start;
+  assert(crc_hw == crc);
+  (void)printf("CRC-32 of %lu bytes, hardware: %lu bytes per kilocycle\n",
+               (unsigned long)size, bench_bytes_per_kcycle(size, hardware));
+#else
+  (void)crc;
+#endif
+  return 0;
+}
+
+int main(void) {
+  initialise_monitor_handles();
+  (void)printf("Hello, World from %s!!!\n", "ring_buf_bench_test");
+  cycles_init();
+
+  assert(ring_buf_pow2_bench() == 0);
+  assert(ring_buf_copy_bench() == 0);
+  assert(ring_buf_find_bench() == 0);
+  assert(ring_buf_crc_bench() == 0);
+
+  _exit(0);
+  return 0;
+}
@@ -0,0 +1,159 @@
+#include "ring_buf_cobs.h"
+#include "monitor_handles.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+RING_BUF_DEFINE_STATIC(test_cobs, 300);
+
+/*
+ * Start the zones at an arbitrary offset so that frames wrap anywhere.
+ */
+static void test_cobs_reset(ring_buf_size_t skip) {
+  ring_buf_reset(&test_cobs, 0);
+  assert(ring_buf_put_claim(&test_cobs, NULL, skip) == skip);
+  assert(ring_buf_put_ack(&test_cobs, skip) == 0);
+  assert(ring_buf_get_all(&test_cobs, NULL, skip) == 0);
+}
+
+/*
+ * Encode then compare the raw buffer contents with the expected encoding.
+ */
+static void test_cobs_encodes(const uint8_t *data, ring_buf_size_t size,
+                              const uint8_t *expected,
+                              ring_buf_size_t encoded) {
+  static uint8_t raw[300];
+  test_cobs_reset(290U);
+  const int ack = ring_buf_cobs_put(&test_cobs, data, size);
+  assert(ack == (int)encoded);
+  assert(ring_buf_put_ack(&test_cobs, ack) == 0);
+  assert(ring_buf_get_all(&test_cobs, raw, encoded) == 0);
+  assert(memcmp(raw, expected, encoded) == 0);
+}
+
+int ring_buf_cobs_vector_test(void) {
+  static const uint8_t zero[] = {0x00}, zero_encoded[] = {0x01, 0x01, 0x00};
+  test_cobs_encodes(zero, sizeof(zero), zero_encoded, sizeof(zero_encoded));
+  static const uint8_t zeros[] = {0x00, 0x00},
+                       zeros_encoded[] = {0x01, 0x01, 0x01, 0x00};
+  test_cobs_encodes(zeros, sizeof(zeros), zeros_encoded,
+                    sizeof(zeros_encoded));
+  static const uint8_t mixed[] = {0x11, 0x22, 0x00, 0x33},
+                       mixed_encoded[] = {0x03, 0x11, 0x22, 0x02, 0x33, 0x00};
+  test_cobs_encodes(mixed, sizeof(mixed), mixed_encoded,
+                    sizeof(mixed_encoded));
+  static const uint8_t trailing[] = {0x11, 0x00, 0x00, 0x00},
+                       trailing_encoded[] = {0x02, 0x11, 0x01,
+                                             0x01, 0x01, 0x00};
+  test_cobs_encodes(trailing, sizeof(trailing), trailing_encoded,
+                    sizeof(trailing_encoded));
+
+  /*
+   * A full block of 254 non-zero bytes needs no empty block after it; one
+   * more byte starts a second block.
+   */
+  static uint8_t block[255], block_encoded[258];
+  for (size_t i = 0; i < sizeof(block); i++)
+    block[i] = (uint8_t)(i + 1U);
+  block_encoded[0] = 0xff;
+  (void)memcpy(block_encoded + 1, block, 254U);
+  block_encoded[255] = 0x00;
+  test_cobs_encodes(block, 254U, block_encoded, 256U);
+  block_encoded[255] = 0x02;
+  block_encoded[256] = 0xff;
+  block_encoded[257] = 0x00;
+  test_cobs_encodes(block, 255U, block_encoded, 258U);
+  return 0;
+}
+
+int ring_buf_cobs_round_trip_test(void) {
+  static uint8_t in[300], out[300];
+  uint32_t seed = 1U;
+  for (ring_buf_size_t skip = 0U; skip < test_cobs.size; skip += 7U) {
+    for (ring_buf_size_t size = 0U; RING_BUF_COBS_MAX(size) <= test_cobs.size;
+         size += 13U) {
+      /*
+       * Mostly non-zero bytes with runs of zeros and long non-zero stretches.
+       */
+      for (ring_buf_size_t i = 0U; i < size; i++) {
+        seed = seed * 1103515245U + 12345U;
+        in[i] = (seed >> 16) % 5U == 0U ? 0U : (uint8_t)(seed >> 24 | 1U);
+      }
+      test_cobs_reset(skip);
+      const int put = ring_buf_cobs_put(&test_cobs, in, size);
+      assert(put > 0 && (ring_buf_size_t)put <= RING_BUF_COBS_MAX(size));
+      assert(ring_buf_put_ack(&test_cobs, put) == 0);
+      ring_buf_size_t length;
+      const int got = ring_buf_cobs_get(&test_cobs, out, sizeof(out), &length);
+      assert(got == put);
+      assert(ring_buf_get_ack(&test_cobs, got) == 0);
+      assert(length == size && memcmp(in, out, size) == 0);
+      assert(ring_buf_is_empty(&test_cobs));
+    }
+  }
+  return 0;
+}
+
+int ring_buf_cobs_frame_test(void) {
+  test_cobs_reset(250U);
+
+  /*
+   * Parts encode as one frame. Zeros inside the frame never reach the buffer.
+   */
+  static const uint8_t header[] = {0x7e, 0x00}, payload[] = {0x00, 0x01};
+  const struct ring_buf_iovec iov[] = {{(void *)header, sizeof(header)},
+                                       {(void *)payload, sizeof(payload)}};
+  int ack = ring_buf_cobs_putv(&test_cobs, iov, 2);
+  assert(ring_buf_put_ack(&test_cobs, ack) == 0);
+  ack = ring_buf_cobs_put(&test_cobs, "abc", 3U);
+  assert(ring_buf_put_ack(&test_cobs, ack) == 0);
+
+  uint8_t out[8];
+  ring_buf_size_t length;
+  assert(ring_buf_cobs_get(&test_cobs, out, 3U, &length) == -EMSGSIZE);
+  ack = ring_buf_cobs_get(&test_cobs, out, sizeof(out), &length);
+  assert(ack == 6 && length == 4U);
+  assert(memcmp(out, "\x7e\x00\x00\x01", 4U) == 0);
+  assert(ring_buf_get_ack(&test_cobs, ack) == 0);
+
+  /*
+   * Partial frames wait for their delimiter. Corrupt frames stay until
+   * skipped, after which the next frame decodes.
+   */
+  assert(ring_buf_put_all(&test_cobs, "\x05xy\x00", 4U) == 0);
+  ack = ring_buf_cobs_get(&test_cobs, NULL, sizeof(out), &length);
+  assert(ack == 5 && length == 3U);
+  assert(ring_buf_get_ack(&test_cobs, ack) == 0);
+  assert(ring_buf_cobs_get(&test_cobs, out, sizeof(out), &length) == -EBADMSG);
+  ack = ring_buf_cobs_skip(&test_cobs);
+  assert(ack == 4);
+  assert(ring_buf_get_ack(&test_cobs, ack) == 0);
+  assert(ring_buf_cobs_get(&test_cobs, out, sizeof(out), &length) == -EAGAIN);
+  assert(ring_buf_put_all(&test_cobs, "\x02z", 2U) == 0);
+  assert(ring_buf_cobs_get(&test_cobs, out, sizeof(out), &length) == -EAGAIN);
+  assert(ring_buf_put_all(&test_cobs, "\x00", 1U) == 0);
+  ack = ring_buf_cobs_get(&test_cobs, out, sizeof(out), &length);
+  assert(ack == 3 && length == 1U && out[0] == 'z');
+  assert(ring_buf_get_ack(&test_cobs, ack) == 0);
+
+  /*
+   * Worst case must fit, whatever the data.
+   */
+  static uint8_t big[300];
+  assert(ring_buf_cobs_put(&test_cobs, big, 298U) == -EMSGSIZE);
+  return 0;
+}
+
+int main(void) {
+  initialise_monitor_handles();
+  (void)printf("Hello, World from %s!!!\n", "ring_buf_cobs_test");
+
+  assert(ring_buf_cobs_vector_test() == 0);
+  assert(ring_buf_cobs_round_trip_test() == 0);
+  assert(ring_buf_cobs_frame_test() == 0);
+
+  _exit(0);
+  return 0;
+}
@@ -0,0 +1,81 @@
+#include "ring_buf_crc.h"
+#include "monitor_handles.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <unistd.h>
+
+RING_BUF_DEFINE_STATIC(test_crc, 100);
+
+/*
+ * Reference CRC, one bit at a time.
+ */
+static uint32_t test_crc_bitwise(uint32_t crc, const uint8_t *data,
+                                 ring_buf_size_t size) {
+  while (size--) {
+    crc ^= (uint32_t)*data++ << 24;
+    for (int bit = 0; bit < 8; bit++)
+      crc = crc & 0x80000000U ? crc << 1 ^ 0x04c11db7U : crc << 1;
+  }
+  return crc;
+}
+
+int ring_buf_crc_check_test(void) {
+  assert(ring_buf_crc32(RING_BUF_CRC32_INIT, "123456789", 9U) == 0x0376e6e7U);
+
+  /*
+   * Every alignment and length, whole and split in two.
+   */
+  static uint8_t data[64];
+  for (size_t i = 0; i < sizeof(data); i++)
+    data[i] = (uint8_t)(i * 37U + 11U);
+  for (ring_buf_size_t offset = 0U; offset < 8U; offset++)
+    for (ring_buf_size_t size = 0U; offset + size <= sizeof(data); size++) {
+      const uint32_t crc =
+          test_crc_bitwise(RING_BUF_CRC32_INIT, data + offset, size);
+      assert(ring_buf_crc32(RING_BUF_CRC32_INIT, data + offset, size) == crc);
+      const ring_buf_size_t half = size / 2U;
+      assert(ring_buf_crc32(ring_buf_crc32(RING_BUF_CRC32_INIT, data + offset,
+                                           half),
+                            data + offset + half, size - half) == crc);
+    }
+  return 0;
+}
+
+int ring_buf_crc_used_test(void) {
+  static uint8_t data[90];
+  for (size_t i = 0; i < sizeof(data); i++)
+    data[i] = (uint8_t)(i ^ 0x5aU);
+  for (ring_buf_size_t skip = 0U; skip < test_crc.size; skip += 3U) {
+    ring_buf_reset(&test_crc, 0);
+    assert(ring_buf_put_claim(&test_crc, NULL, skip) == skip);
+    assert(ring_buf_put_ack(&test_crc, skip) == 0);
+    assert(ring_buf_get_all(&test_crc, NULL, skip) == 0);
+    assert(ring_buf_put_all(&test_crc, data, sizeof(data)) == 0);
+
+    /*
+     * Regions straddle the wrap in place, without copying out.
+     */
+    for (ring_buf_size_t offset = 0U; offset < sizeof(data); offset += 11U) {
+      const ring_buf_size_t size = sizeof(data) - offset;
+      assert(ring_buf_crc32_used(&test_crc, offset, size) ==
+             test_crc_bitwise(RING_BUF_CRC32_INIT, data + offset, size));
+    }
+    struct ring_buf_span spans[2];
+    (void)ring_buf_used_spans(&test_crc, spans);
+    assert(ring_buf_crc32_spans(RING_BUF_CRC32_INIT, spans) ==
+           test_crc_bitwise(RING_BUF_CRC32_INIT, data, sizeof(data)));
+  }
+  return 0;
+}
+
+int main(void) {
+  initialise_monitor_handles();
+  (void)printf("Hello, World from %s!!!\n", "ring_buf_crc_test");
+
+  assert(ring_buf_crc_check_test() == 0);
+  assert(ring_buf_crc_used_test() == 0);
+
+  _exit(0);
+  return 0;
+}
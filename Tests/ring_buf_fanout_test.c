@@ -0,0 +1,77 @@
+#include "ring_buf_fanout.h"
+#include "monitor_handles.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <unistd.h>
+
+/*
+ * Three readers, e.g. correlation, logging and metering, over one stream.
+ */
+RING_BUF_FANOUT_DEFINE_STATIC(test_fanout, 100, 3);
+
+#define TEST_FANOUT_BYTES 10000U
+
+/*
+ * Every reader must see every byte in order at its own pace. Reader n gets
+ * n + 1 bytes per turn, so the first reader always lags and bounds the free
+ * space; the producer must never overwrite what it has not read.
+ */
+int ring_buf_fanout_test(void) {
+  for (int reader = 0; reader < test_fanout.count; reader++)
+    ring_buf_fanout_reset(&test_fanout, reader);
+  uint8_t put = 0U;
+  uint32_t got[3] = {0U};
+  while (got[0] < TEST_FANOUT_BYTES) {
+    while (put < 255U && ring_buf_put_all(test_fanout.buf, &put, 1U) == 0)
+      put++;
+    if (put == 255U)
+      put = 0U;
+    assert(ring_buf_free_space(test_fanout.buf) ==
+           test_fanout.buf->size - ring_buf_fanout_used_space(&test_fanout, 0));
+    for (int reader = 0; reader < test_fanout.count; reader++) {
+      uint8_t data[3];
+      const ring_buf_size_t size = (ring_buf_size_t)reader + 1U;
+      if (ring_buf_fanout_get_all(&test_fanout, reader, data, size) < 0)
+        continue;
+      for (ring_buf_size_t i = 0U; i < size; i++)
+        assert(data[i] == (uint8_t)(got[reader]++ % 255U));
+    }
+  }
+  (void)printf("%lu bytes fanned out to %d readers\n",
+               (unsigned long)got[0], test_fanout.count);
+  return 0;
+}
+
+/*
+ * Resetting the slowest reader releases its space to the producer at once.
+ */
+int ring_buf_fanout_reset_test(void) {
+  struct ring_buf *buf = test_fanout.buf;
+  for (int reader = 0; reader < test_fanout.count; reader++)
+    ring_buf_fanout_reset(&test_fanout, reader);
+  assert(ring_buf_free_space(buf) == buf->size);
+  static const uint8_t data[] = "fan-out";
+  assert(ring_buf_put_all(buf, data, sizeof(data)) == 0);
+  assert(ring_buf_fanout_get_all(&test_fanout, 1, NULL, sizeof(data)) == 0);
+  assert(ring_buf_fanout_get_all(&test_fanout, 2, NULL, sizeof(data)) == 0);
+  assert(ring_buf_free_space(buf) == buf->size - sizeof(data));
+  ring_buf_fanout_reset(&test_fanout, 0);
+  assert(ring_buf_free_space(buf) == buf->size);
+  assert(ring_buf_fanout_get_all(&test_fanout, 0, NULL, 1U) == -EAGAIN);
+  void *space;
+  assert(ring_buf_fanout_get_ack(&test_fanout, 0, 1U) == -EINVAL);
+  assert(ring_buf_fanout_get_claim(&test_fanout, 0, &space, 1U) == 0U);
+  return 0;
+}
+
+int main(void) {
+  initialise_monitor_handles();
+  (void)printf("Hello, World from %s!!!\n", "ring_buf_fanout_test");
+
+  assert(ring_buf_fanout_test() == 0);
+  assert(ring_buf_fanout_reset_test() == 0);
+
+  _exit(0);
+  return 0;
+}
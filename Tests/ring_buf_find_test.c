@@ -0,0 +1,94 @@
+#include "ring_buf_find.h"
+#include "monitor_handles.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+RING_BUF_DEFINE_STATIC(test_find, 50);
+
+/*
+ * Put the bytes after a given number of put-and-get bytes so that the data
+ * starts at any alignment and wraps at any point.
+ */
+static void test_find_load(ring_buf_size_t skip, const uint8_t *data,
+                           ring_buf_size_t size) {
+  ring_buf_reset(&test_find, 0);
+  assert(ring_buf_put_claim(&test_find, NULL, skip) == skip);
+  assert(ring_buf_put_ack(&test_find, skip) == 0);
+  assert(ring_buf_get_all(&test_find, NULL, skip) == 0);
+  assert(ring_buf_put_all(&test_find, data, size) == 0);
+}
+
+/*
+ * Reference search over the linear copy.
+ */
+static ring_buf_ptrdiff_t test_find_naive(const uint8_t *data,
+                                          ring_buf_size_t size,
+                                          const uint8_t *pattern,
+                                          ring_buf_size_t length,
+                                          ring_buf_size_t offset) {
+  for (ring_buf_size_t at = offset; at + length <= size; at++)
+    if (memcmp(data + at, pattern, length) == 0)
+      return at;
+  return -EAGAIN;
+}
+
+int ring_buf_find_byte_test(void) {
+  uint8_t data[47];
+  for (size_t i = 0; i < sizeof(data); i++)
+    data[i] = (uint8_t)(i * 7U % 11U);
+  for (ring_buf_size_t skip = 0U; skip < test_find.size; skip++) {
+    test_find_load(skip, data, sizeof(data));
+    for (unsigned byte = 0U; byte < 12U; byte++)
+      for (ring_buf_size_t offset = 0U; offset <= sizeof(data); offset++) {
+        const uint8_t b = (uint8_t)byte;
+        assert(ring_buf_find_byte(&test_find, b, offset) ==
+               test_find_naive(data, sizeof(data), &b, 1U, offset));
+      }
+  }
+  return 0;
+}
+
+int ring_buf_find_pattern_test(void) {
+  static const uint8_t data[] = "GET / HTTP/1.1\r\nHost: a\r\n\r\nxx\r\n\r";
+  static const char *const patterns[] = {"\r\n\r\n", "\r\n", "HTTP", "xx\r",
+                                         "\r\r",     "a\r\n", "/"};
+  const ring_buf_size_t size = sizeof(data) - 1U;
+  for (ring_buf_size_t skip = 0U; skip < test_find.size; skip++) {
+    test_find_load(skip, data, size);
+    for (size_t i = 0; i < sizeof(patterns) / sizeof(patterns[0]); i++) {
+      const uint8_t *pattern = (const uint8_t *)patterns[i];
+      const ring_buf_size_t length = strlen(patterns[i]);
+      for (ring_buf_size_t offset = 0U; offset <= size; offset++)
+        assert(ring_buf_find_pattern(&test_find, pattern, length, offset) ==
+               test_find_naive(data, size, pattern, length, offset));
+    }
+  }
+
+  /*
+   * The found offset frames the header for a get.
+   */
+  test_find_load(40U, data, size);
+  const ring_buf_ptrdiff_t found =
+      ring_buf_find_pattern(&test_find, "\r\n\r\n", 4U, 0U);
+  assert(found == 23);
+  uint8_t header[27];
+  assert(ring_buf_get_all(&test_find, header, found + 4) == 0);
+  assert(memcmp(header, data, sizeof(header)) == 0);
+  assert(ring_buf_find_pattern(&test_find, "\r\n\r\n", 4U, 0U) == -EAGAIN);
+  assert(ring_buf_find_pattern(&test_find, "", 0U, 0U) == 0);
+  return 0;
+}
+
+int main(void) {
+  initialise_monitor_handles();
+  (void)printf("Hello, World from %s!!!\n", "ring_buf_find_test");
+
+  assert(ring_buf_find_byte_test() == 0);
+  assert(ring_buf_find_pattern_test() == 0);
+
+  _exit(0);
+  return 0;
+}
@@ -0,0 +1,280 @@
+#include "ring_buf_bip.h"
+#include "ring_buf_item.h"
+#include "monitor_handles.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+/*
+ * Odd size so that the space left before the end is sometimes too small for
+ * a length prefix and the skip is implicit.
+ */
+RING_BUF_DEFINE_STATIC(test_bip, 101);
+
+static uint8_t test_bip_byte(uint32_t seq, ring_buf_item_length_t i) {
+  return (uint8_t)(seq * 31U + i);
+}
+
+/*
+ * Items of varying length, most of them wrapping sooner or later. Every item
+ * must come back contiguous, whole and in order.
+ */
+int ring_buf_bip_test(void) {
+  uint8_t item[40];
+  uint32_t put = 0U, got = 0U, skips = 0U;
+  while (got < 2000U) {
+    for (;;) {
+      const ring_buf_item_length_t length = (put * 7U) % sizeof(item);
+      for (ring_buf_item_length_t i = 0U; i < length; i++)
+        item[i] = test_bip_byte(put, i);
+      const int ack = ring_buf_bip_put(&test_bip, item, length);
+      if (ack < 0)
+        break;
+      if ((ring_buf_size_t)ack > sizeof(length) + length)
+        skips++;
+      assert(ring_buf_put_ack(&test_bip, ack) == 0);
+      put++;
+    }
+    void *space;
+    ring_buf_item_length_t length;
+    const int ack = ring_buf_bip_get_claim(&test_bip, &space, &length);
+    assert(ack >= 0);
+    assert(length == (got * 7U) % sizeof(item));
+    const uint8_t *first = space, *space_begin = test_bip.space;
+    assert(first >= space_begin);
+    assert(first + length <= space_begin + test_bip.size);
+    for (ring_buf_item_length_t i = 0U; i < length; i++)
+      assert(first[i] == test_bip_byte(got, i));
+    assert(ring_buf_get_ack(&test_bip, ack) == 0);
+    got++;
+  }
+  int ack;
+  void *space;
+  ring_buf_item_length_t length;
+  while ((ack = ring_buf_bip_get_claim(&test_bip, &space, &length)) >= 0)
+    assert(ring_buf_get_ack(&test_bip, ack) == 0);
+  assert(ack == -EAGAIN && ring_buf_is_empty(&test_bip));
+  assert(ring_buf_bip_put(&test_bip, item, RING_BUF_BIP_SKIP) == -EMSGSIZE);
+  (void)printf("%lu items, %lu skips\n", (unsigned long)got,
+               (unsigned long)skips);
+  return 0;
+}
+
+/*
+ * Serialise telemetry straight into the buffer space: claim the worst case,
+ * write fewer bytes, commit the actual length.
+ */
+int ring_buf_bip_claim_test(void) {
+  uint32_t put = 0U, got = 0U;
+  while (got < 1000U) {
+    void *space;
+    while (ring_buf_bip_put_claim(&test_bip, 32U, &space) == 0) {
+      const ring_buf_item_length_t length = put % 33U;
+      for (ring_buf_item_length_t i = 0U; i < length; i++)
+        ((uint8_t *)space)[i] = test_bip_byte(put, i);
+      assert(ring_buf_bip_put_commit(&test_bip, length) == 0);
+      put++;
+    }
+    ring_buf_item_length_t length;
+    const int ack = ring_buf_bip_get_claim(&test_bip, &space, &length);
+    assert(ack >= 0);
+    assert(length == got % 33U);
+    for (ring_buf_item_length_t i = 0U; i < length; i++)
+      assert(((const uint8_t *)space)[i] == test_bip_byte(got, i));
+    assert(ring_buf_get_ack(&test_bip, ack) == 0);
+    got++;
+  }
+
+  /*
+   * Commit needs a claim and cannot grow it.
+   */
+  void *space;
+  assert(ring_buf_bip_put_commit(&test_bip, 0U) == -EINVAL);
+  while (ring_buf_bip_put_claim(&test_bip, 8U, &space) < 0) {
+    ring_buf_item_length_t length;
+    const int ack = ring_buf_bip_get_claim(&test_bip, &space, &length);
+    assert(ring_buf_get_ack(&test_bip, ack) == 0);
+  }
+  assert(ring_buf_bip_put_commit(&test_bip, 9U) == -EINVAL);
+  assert(ring_buf_bip_put_commit(&test_bip, 8U) == 0);
+  return 0;
+}
+
+/*
+ * Plain items may wrap, so route them by peeking rather than claiming.
+ */
+RING_BUF_DEFINE_STATIC(test_item, 50);
+
+static int test_item_yield(const struct ring_buf_span spans[2],
+                           ring_buf_item_length_t length, int index,
+                           void *extra) {
+  uint32_t *sum = extra;
+  assert(spans[0].size + spans[1].size == length);
+  assert(length == 0U || ((const uint8_t *)spans[0].space)[0] == index);
+  for (int i = 0; i < 2; i++)
+    for (ring_buf_size_t j = 0U; j < spans[i].size; j++)
+      *sum += ((const uint8_t *)spans[i].space)[j];
+  return -EAGAIN;
+}
+
+int ring_buf_item_peek_test(void) {
+  ring_buf_item_length_t length;
+  uint8_t route;
+  assert(ring_buf_item_peek_length(&test_item, &length) == -EAGAIN);
+  assert(ring_buf_item_peek(&test_item, &route, sizeof(route)) == -EAGAIN);
+  assert(ring_buf_item_skip(&test_item) == -EAGAIN);
+
+  /*
+   * Offset the zones so that items wrap around the end of the buffer space.
+   */
+  assert(ring_buf_put_ack(&test_item, ring_buf_put(&test_item, NULL, 45U)) ==
+         0);
+  assert(ring_buf_get_ack(&test_item, ring_buf_get(&test_item, NULL, 45U)) ==
+         0);
+
+  /*
+   * Each item's first byte is its index, its route.
+   */
+  uint32_t expected = 0U;
+  for (uint8_t index = 0U; index < 4U; index++) {
+    const uint8_t item[] = {index, 10U, 20U, 30U, 40U};
+    const ring_buf_item_length_t size = index + 2U;
+    assert(ring_buf_put_ack(&test_item,
+                            ring_buf_item_put(&test_item, item, size)) == 0);
+    for (ring_buf_item_length_t i = 0U; i < size; i++)
+      expected += item[i];
+  }
+  uint32_t sum = 0U;
+  assert(ring_buf_item_yield(&test_item, test_item_yield, &sum) == 4);
+  assert(sum == expected);
+
+  /*
+   * Drop route 0, forward the rest.
+   */
+  for (uint8_t index = 0U; index < 4U; index++) {
+    assert(ring_buf_item_peek_length(&test_item, &length) == 0);
+    assert(length == index + 2U);
+    assert(ring_buf_item_peek(&test_item, &route, sizeof(route)) == 1);
+    assert(route == index);
+    if (route == 0U) {
+      const int ack = ring_buf_item_skip(&test_item);
+      assert(ack == (int)(sizeof(length) + length));
+      assert(ring_buf_get_ack(&test_item, ack) == 0);
+      continue;
+    }
+    uint8_t item[5];
+    const int ack = ring_buf_item_get(&test_item, item, &length);
+    assert(item[0] == route && item[length - 1U] == 10U * (length - 1U));
+    assert(ring_buf_get_ack(&test_item, ack) == 0);
+  }
+  assert(ring_buf_is_empty(&test_item));
+
+  /*
+   * A foreign length prefix running past the used space stops the walk after
+   * the good items before it.
+   */
+  const uint8_t item[] = {0U, 1U, 2U};
+  assert(ring_buf_put_ack(&test_item, ring_buf_item_put(&test_item, item,
+                                                        sizeof(item))) == 0);
+  const ring_buf_item_length_t bad = 1000U;
+  assert(ring_buf_put_all(&test_item, &bad, sizeof(bad)) == 0);
+  assert(ring_buf_put_all(&test_item, "abcd", 4U) == 0);
+  sum = 0U;
+  assert(ring_buf_item_yield(&test_item, test_item_yield, &sum) == -EBADMSG);
+  assert(sum == 3U);
+  ring_buf_reset(&test_item, 0);
+  return 0;
+}
+
+/*
+ * Large enough for an item with a three-byte varint prefix.
+ */
+RING_BUF_DEFINE_STATIC(test_varint, 16500);
+
+int ring_buf_item_varint_test(void) {
+  static const struct {
+    uint32_t length;
+    int prefix;
+  } cases[] = {{0U, 1},   {1U, 1},     {127U, 1},   {128U, 2},
+               {300U, 2}, {16383U, 2}, {16384U, 3}};
+  uint32_t length;
+  assert(ring_buf_item_get_varint(&test_varint, NULL, &length) == -EAGAIN);
+  for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+    int ack = ring_buf_item_put_varint(&test_varint, NULL, cases[i].length);
+    assert(ack == cases[i].prefix + (int)cases[i].length);
+    assert(ring_buf_put_ack(&test_varint, ack) == 0);
+    ack = ring_buf_item_get_varint(&test_varint, NULL, &length);
+    assert(ack == cases[i].prefix + (int)cases[i].length);
+    assert(ring_buf_get_ack(&test_varint, ack) == 0);
+    assert(length == cases[i].length);
+  }
+
+  /*
+   * Small items with content, one header byte each.
+   */
+  static const uint8_t item[] = "event";
+  int ack = ring_buf_item_put_varint(&test_varint, item, sizeof(item));
+  assert(ring_buf_put_ack(&test_varint, ack) == 0);
+  assert(ring_buf_used_space(&test_varint) == 1U + sizeof(item));
+  uint8_t got[sizeof(item)];
+  ack = ring_buf_item_get_varint(&test_varint, got, &length);
+  assert(ring_buf_get_ack(&test_varint, ack) == 0);
+  assert(length == sizeof(item) && memcmp(got, item, length) == 0);
+  assert(ring_buf_item_put_varint(&test_varint, NULL, test_varint.size) ==
+         -EMSGSIZE);
+  assert(ring_buf_item_put_varint(&test_varint, NULL, 70000U) == -EMSGSIZE);
+  return 0;
+}
+
+int ring_buf_item_varint_bad_test(void) {
+  uint32_t length;
+  ring_buf_reset(&test_varint, 0);
+
+  /*
+   * A truncated prefix or item claims nothing and waits for the rest.
+   */
+  assert(ring_buf_put_all(&test_varint, "\x85", 1U) == 0);
+  assert(ring_buf_item_get_varint(&test_varint, NULL, &length) == -EAGAIN);
+  assert(ring_buf_put_all(&test_varint, "\0abc", 4U) == 0);
+  assert(ring_buf_item_get_varint(&test_varint, NULL, &length) == -EAGAIN);
+  assert(test_varint.get.head == test_varint.get.tail);
+  assert(ring_buf_put_all(&test_varint, "de", 2U) == 0);
+  uint8_t got[5];
+  int ack = ring_buf_item_get_varint(&test_varint, got, &length);
+  assert(ack == 7 && length == 5U && memcmp(got, "abcde", 5U) == 0);
+  assert(ring_buf_get_ack(&test_varint, ack) == 0);
+
+  /*
+   * An overlong prefix, or a length too large for the buffer, claims nothing.
+   * Discarding the bad bytes lets the next item through.
+   */
+  assert(ring_buf_put_all(&test_varint, "\xff\xff\xff\xff\x1f", 5U) == 0);
+  assert(ring_buf_item_get_varint(&test_varint, NULL, &length) == -EBADMSG);
+  assert(test_varint.get.head == test_varint.get.tail);
+  assert(ring_buf_get_all(&test_varint, NULL, 5U) == 0);
+  assert(ring_buf_put_all(&test_varint, "\x80\x81\x01", 3U) == 0);
+  assert(ring_buf_item_get_varint(&test_varint, NULL, &length) == -EBADMSG);
+  assert(ring_buf_get_all(&test_varint, NULL, 3U) == 0);
+  ack = ring_buf_item_put_varint(&test_varint, "x", 1U);
+  assert(ring_buf_put_ack(&test_varint, ack) == 0);
+  ack = ring_buf_item_get_varint(&test_varint, got, &length);
+  assert(ack == 2 && length == 1U && got[0] == 'x');
+  assert(ring_buf_get_ack(&test_varint, ack) == 0);
+  return 0;
+}
+
+int main(void) {
+  initialise_monitor_handles();
+  (void)printf("Hello, World from %s!!!\n", "ring_buf_item_test");
+
+  assert(ring_buf_bip_test() == 0);
+  assert(ring_buf_bip_claim_test() == 0);
+  assert(ring_buf_item_peek_test() == 0);
+  assert(ring_buf_item_varint_test() == 0);
+  assert(ring_buf_item_varint_bad_test() == 0);
+
+  _exit(0);
+  return 0;
+}
@@ -0,0 +1,137 @@
+#include "ring_buf_mp.h"
+#include "ring_buf_spsc.h"
+#include "monitor_handles.h"
+#include "stm32f4xx.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+RING_BUF_MP_DEFINE_STATIC(test_mp, 250);
+
+/*
+ * Three producers: thread mode, SysTick, and EXTI0 pended by software from
+ * inside SysTick's open reservation so that it nests at a higher priority.
+ */
+enum { TEST_MP_THREAD, TEST_MP_SYSTICK, TEST_MP_EXTI0, TEST_MP_PRODUCERS };
+
+#define TEST_MP_RECORDS 5000U
+#define TEST_MP_RELOAD 2000U
+
+struct test_mp_record {
+  uint32_t producer;
+  uint32_t seq;
+  uint32_t check;
+};
+
+static volatile uint32_t test_mp_seq[TEST_MP_PRODUCERS];
+static volatile uint32_t test_mp_overruns[TEST_MP_PRODUCERS];
+
+static struct test_mp_record test_mp_record(uint32_t producer, uint32_t seq) {
+  const struct test_mp_record record = {
+      .producer = producer, .seq = seq, .check = (producer * 2654435761U) ^ seq};
+  return record;
+}
+
+/*
+ * Put one record for a producer unless it has finished. Advance the
+ * producer's sequence only on success so that the consumer can expect every
+ * sequence number exactly once.
+ */
+static void test_mp_put(uint32_t producer) {
+  const uint32_t seq = test_mp_seq[producer];
+  if (seq >= TEST_MP_RECORDS)
+    return;
+  const struct test_mp_record record = test_mp_record(producer, seq);
+  if (ring_buf_mp_put(&test_mp, &record, sizeof(record)) < 0) {
+    test_mp_overruns[producer]++;
+    return;
+  }
+  test_mp_seq[producer] = seq + 1U;
+}
+
+void EXTI0_IRQHandler(void) { test_mp_put(TEST_MP_EXTI0); }
+
+/*
+ * Reserve, then let the higher-priority producer reserve, write and commit
+ * while this reservation remains open. The nested commit must not publish
+ * the outer reservation before the outer producer writes it.
+ */
+void SysTick_Handler(void) {
+  const uint32_t seq = test_mp_seq[TEST_MP_SYSTICK];
+  if (seq >= TEST_MP_RECORDS) {
+    NVIC_SetPendingIRQ(EXTI0_IRQn);
+    return;
+  }
+  struct ring_buf_span spans[2];
+  if (ring_buf_mp_put_claim(&test_mp, sizeof(struct test_mp_record), spans) <
+      0) {
+    ring_buf_mp_put_commit(&test_mp);
+    test_mp_overruns[TEST_MP_SYSTICK]++;
+    return;
+  }
+  NVIC_SetPendingIRQ(EXTI0_IRQn);
+  __DSB();
+  __ISB();
+  const struct test_mp_record record = test_mp_record(TEST_MP_SYSTICK, seq);
+  (void)memcpy(spans[0].space, &record, spans[0].size);
+  (void)memcpy(spans[1].space, (const uint8_t *)&record + spans[0].size,
+               spans[1].size);
+  ring_buf_mp_put_commit(&test_mp);
+  test_mp_seq[TEST_MP_SYSTICK] = seq + 1U;
+}
+
+static bool test_mp_done(void) {
+  for (uint32_t producer = 0U; producer < TEST_MP_PRODUCERS; producer++)
+    if (test_mp_seq[producer] < TEST_MP_RECORDS)
+      return false;
+  return true;
+}
+
+int ring_buf_mp_test(void) {
+  NVIC_SetPriority(EXTI0_IRQn, 1U);
+  NVIC_EnableIRQ(EXTI0_IRQn);
+  (void)SysTick_Config(TEST_MP_RELOAD);
+  NVIC_SetPriority(SysTick_IRQn, 2U);
+
+  /*
+   * Consume in thread mode between thread-mode puts. Records from each
+   * producer must arrive intact and in that producer's order.
+   */
+  uint32_t expected[TEST_MP_PRODUCERS] = {0U};
+  uint32_t received = 0U;
+  while (received < TEST_MP_PRODUCERS * TEST_MP_RECORDS) {
+    test_mp_put(TEST_MP_THREAD);
+    struct test_mp_record record;
+    while (ring_buf_spsc_get_all(test_mp.buf, &record, sizeof(record)) == 0) {
+      assert(record.producer < TEST_MP_PRODUCERS);
+      assert(record.seq == expected[record.producer]);
+      assert(record.check == test_mp_record(record.producer, record.seq).check);
+      expected[record.producer]++;
+      received++;
+    }
+  }
+  SysTick->CTRL = 0U;
+  NVIC_DisableIRQ(EXTI0_IRQn);
+
+  assert(test_mp_done());
+  assert(test_mp.writers == 0U);
+  assert(ring_buf_spsc_used_space(test_mp.buf) == 0U);
+  (void)printf("%lu records, overruns: thread %lu, SysTick %lu, EXTI0 %lu\n",
+               (unsigned long)received,
+               (unsigned long)test_mp_overruns[TEST_MP_THREAD],
+               (unsigned long)test_mp_overruns[TEST_MP_SYSTICK],
+               (unsigned long)test_mp_overruns[TEST_MP_EXTI0]);
+  return 0;
+}
+
+int main(void) {
+  initialise_monitor_handles();
+  (void)printf("Hello, World from %s!!!\n", "ring_buf_mp_test");
+
+  assert(ring_buf_mp_test() == 0);
+
+  _exit(0);
+  return 0;
+}
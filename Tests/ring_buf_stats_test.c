@@ -0,0 +1,62 @@
+#include "ring_buf.h"
+#include "ring_buf_circ.h"
+#include "monitor_handles.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#ifndef RING_BUF_STATS
+#error "ring_buf_stats_test requires RING_BUF_STATS"
+#endif
+
+RING_BUF_DEFINE_STATIC(test_stats, 10);
+
+static void ring_buf_stats_dump(const struct ring_buf *buf) {
+  (void)printf("high water %lu of %lu, put %lu, got %lu, short claims %lu, "
+               "rejects %lu, drops %lu\n",
+               (unsigned long)buf->stats.high_water, (unsigned long)buf->size,
+               (unsigned long)buf->stats.put, (unsigned long)buf->stats.got,
+               (unsigned long)buf->stats.short_claims,
+               (unsigned long)buf->stats.rejects,
+               (unsigned long)buf->stats.drops);
+}
+
+int ring_buf_stats_test(void) {
+  struct ring_buf *buf = &test_stats;
+  assert(ring_buf_put_all(buf, "abcdef", 6U) == 0);
+  assert(ring_buf_get_all(buf, NULL, 4U) == 0);
+  assert(buf->stats.high_water == 6U);
+  assert(buf->stats.put == 6U && buf->stats.got == 4U);
+  assert(buf->stats.short_claims == 0U);
+
+  /*
+   * Eight more bytes wrap: the first claim clamps at the end of the buffer
+   * space. Then a put that does not fit is rejected.
+   */
+  assert(ring_buf_put_all(buf, "ghijklmn", 8U) == 0);
+  assert(buf->stats.short_claims == 1U);
+  assert(buf->stats.high_water == 10U);
+  assert(ring_buf_put_all(buf, "o", 1U) == -EMSGSIZE);
+  assert(buf->stats.rejects == 1U);
+
+  /*
+   * Circular puts into a full buffer drop the oldest bytes.
+   */
+  assert(ring_buf_put_circ(buf, "pq", 2U) == 0);
+  assert(buf->stats.drops == 2U);
+  assert(buf->stats.put == 16U && buf->stats.got == 6U);
+
+  ring_buf_stats_dump(buf);
+  return 0;
+}
+
+int main(void) {
+  initialise_monitor_handles();
+  (void)printf("Hello, World from %s!!!\n", "ring_buf_stats_test");
+
+  assert(ring_buf_stats_test() == 0);
+
+  _exit(0);
+  return 0;
+}
@@ -0,0 +1,209 @@
+#include "ring_buf.h"
+#include "ring_buf_type.h"
+#include "monitor_handles.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+int ring_buf_spans_test(void) {
+  RING_BUF_DEFINE_STATIC(buf, 10);
+  struct ring_buf_span spans[2];
+
+  /*
+   * An empty buffer has one free span covering all its space and no used
+   * spans.
+   */
+  assert(ring_buf_free_spans(&buf, spans) == 10U);
+  assert(spans[0].size == 10U && spans[1].size == 0U);
+  assert(ring_buf_used_spans(&buf, spans) == 0U);
+
+  /*
+   * Wrap the used space around the end of the buffer space. The used spans
+   * then split at the end.
+   */
+  assert(ring_buf_put_all(&buf, "abcdefg", 7U) == 0);
+  assert(ring_buf_get_all(&buf, NULL, 5U) == 0);
+  assert(ring_buf_put_all(&buf, "hijkl", 5U) == 0);
+  assert(ring_buf_used_spans(&buf, spans) == 7U);
+  assert(spans[0].size == 5U && memcmp(spans[0].space, "fghij", 5U) == 0);
+  assert(spans[1].size == 2U && memcmp(spans[1].space, "kl", 2U) == 0);
+
+  /*
+   * Fill the free span in place, then claim and acknowledge it in one go.
+   */
+  assert(ring_buf_free_spans(&buf, spans) == 3U);
+  assert(spans[0].size == 3U && spans[1].size == 0U);
+  (void)memcpy(spans[0].space, "mno", 3U);
+  assert(ring_buf_put_ack(&buf, ring_buf_put(&buf, NULL, 3U)) == 0);
+  assert(ring_buf_is_full(&buf));
+
+  /*
+   * Consume everything in place and acknowledge once.
+   */
+  assert(ring_buf_used_spans(&buf, spans) == 10U);
+  assert(memcmp(spans[0].space, "fghij", 5U) == 0);
+  assert(memcmp(spans[1].space, "klmno", 5U) == 0);
+  assert(ring_buf_get_ack(&buf, ring_buf_get(&buf, NULL, 10U)) == 0);
+  assert(ring_buf_is_empty(&buf));
+
+  return 0;
+}
+
+int ring_buf_vectored_test(void) {
+  RING_BUF_DEFINE_STATIC(buf, 16);
+  uint8_t header[3] = {1, 2, 3};
+  char payload[8] = "payload";
+
+  /*
+   * Offset the zones so that the vectored put wraps around the end of the
+   * buffer space part-way through the payload.
+   */
+  assert(ring_buf_put_all(&buf, "0123456789", 10U) == 0);
+  assert(ring_buf_get_all(&buf, NULL, 10U) == 0);
+  const struct ring_buf_iovec put[] = {{header, sizeof(header)},
+                                       {payload, sizeof(payload)}};
+  assert(ring_buf_putv(&buf, put, 2) == 11);
+  assert(ring_buf_put_ack(&buf, 11U) == 0);
+  assert(ring_buf_used_space(&buf) == 11U);
+
+  /*
+   * All or none. Another eleven bytes will not fit.
+   */
+  assert(ring_buf_putv(&buf, put, 2) == -EMSGSIZE);
+
+  /*
+   * Scatter the record back out, discarding the middle header byte.
+   */
+  uint8_t first, last;
+  char copy[8];
+  const struct ring_buf_iovec get[] = {
+      {&first, 1U}, {NULL, 1U}, {&last, 1U}, {copy, sizeof(copy)}};
+  assert(ring_buf_getv(&buf, get, 4) == 11);
+  assert(ring_buf_get_ack(&buf, 11U) == 0);
+  assert(first == 1U && last == 3U);
+  assert(memcmp(copy, payload, sizeof(copy)) == 0);
+  assert(ring_buf_getv(&buf, get, 4) == -EAGAIN);
+
+  return 0;
+}
+
+struct sample {
+  uint32_t ticks;
+  int16_t x, y, z;
+};
+
+RING_BUF_TYPE_DEFINE(ring_buf_sample, struct sample)
+
+int ring_buf_type_test(void) {
+  RING_BUF_TYPE_DEFINE_STATIC(buf, struct sample, 5);
+  struct sample samples[5];
+  for (int i = 0; i < 5; i++)
+    samples[i] = (struct sample){.ticks = i, .x = i, .y = -i, .z = 2 * i};
+
+  /*
+   * Counts are in elements, and claims stop at element boundaries even when
+   * they wrap around the end of the buffer space.
+   */
+  assert(ring_buf_sample_put_all(&buf, samples, 3U) == 0);
+  assert(ring_buf_sample_used_space(&buf) == 3U);
+  assert(ring_buf_sample_free_space(&buf) == 2U);
+  assert(ring_buf_sample_get_all(&buf, NULL, 2U) == 0);
+  assert(ring_buf_sample_put_all(&buf, samples, 4U) == 0);
+  assert(ring_buf_sample_put_all(&buf, samples, 1U) == -EMSGSIZE);
+  struct sample *space;
+  assert(ring_buf_sample_get_claim(&buf, &space, 5U) == 3U);
+  assert(space[0].ticks == 2U && space[1].ticks == 0U && space[2].ticks == 1U);
+  assert(ring_buf_sample_get_claim(&buf, &space, 5U) == 2U);
+  assert(space[0].ticks == 2U && space[1].z == 6);
+  assert(ring_buf_sample_get_ack(&buf, 5U) == 0);
+  assert(ring_buf_is_empty(&buf));
+
+  RING_BUF_TYPE_DEFINE_STATIC_POW2(pow2, uint16_t, 8);
+  assert(pow2.mask == 15U);
+  return 0;
+}
+
+RING_BUF_TYPE_DEFINE(ring_buf_u16, uint16_t)
+
+/*
+ * Look back over the newest samples while older ones drain, so that the
+ * window regularly wraps around the end of the buffer space.
+ */
+static void ring_buf_window_check(struct ring_buf *buf) {
+  for (uint16_t sample = 0U; sample < 100U; sample++) {
+    if (ring_buf_u16_free_space(buf) == 0U)
+      assert(ring_buf_u16_get_all(buf, NULL, 1U) == 0);
+    assert(ring_buf_u16_put_all(buf, &sample, 1U) == 0);
+    const ring_buf_size_t held = ring_buf_u16_used_space(buf);
+    const ring_buf_size_t window = held < 3U ? held : 3U;
+    struct ring_buf_span spans[2];
+    assert(ring_buf_u16_window_spans(buf, 3U, spans) == window);
+    uint16_t newest = sample;
+    for (int i = 1; i >= 0; i--)
+      for (ring_buf_size_t j = spans[i].size / sizeof(uint16_t); j-- > 0U;)
+        assert(((const uint16_t *)spans[i].space)[j] == newest--);
+    for (ring_buf_ptrdiff_t k = 1; k <= (ring_buf_ptrdiff_t)held; k++)
+      assert(*ring_buf_u16_at(buf, -k) == sample + 1 - k);
+    assert(ring_buf_u16_at(buf, -(ring_buf_ptrdiff_t)held - 1) == NULL);
+    assert(ring_buf_u16_at(buf, 0) == NULL);
+  }
+}
+
+int ring_buf_window_test(void) {
+  RING_BUF_TYPE_DEFINE_STATIC(generic, uint16_t, 5);
+  RING_BUF_TYPE_DEFINE_STATIC_POW2(pow2, uint16_t, 4);
+  ring_buf_window_check(&generic);
+  ring_buf_window_check(&pow2);
+  return 0;
+}
+
+/*
+ * Push more bytes through than a 16-bit index spans, starting just short of
+ * the signed 16-bit limit, so that compact indices wrap both ways.
+ */
+static void ring_buf_wrap_check(struct ring_buf *buf) {
+  uint8_t in[37], out[sizeof(in)];
+  uint8_t next = 0U, expected = 0U;
+  ring_buf_reset(buf, INT16_MAX - 100);
+  for (uint32_t round = 0U; round < 4000U; round++) {
+    for (size_t i = 0; i < sizeof(in); i++)
+      in[i] = next++;
+    assert(ring_buf_put_all(buf, in, sizeof(in)) == 0);
+    assert(ring_buf_get_all(buf, out, sizeof(out)) == 0);
+    for (size_t i = 0; i < sizeof(out); i++)
+      assert(out[i] == expected++);
+  }
+  assert(ring_buf_is_empty(buf));
+}
+
+int ring_buf_wrap_test(void) {
+  RING_BUF_DEFINE_STATIC(generic, 250);
+  RING_BUF_DEFINE_STATIC_POW2(pow2, 256);
+  ring_buf_wrap_check(&generic);
+  ring_buf_wrap_check(&pow2);
+
+  /*
+   * Report the footprint. Defining RING_BUF_INDEX_16 narrows the indices and
+   * sizes; the space pointer stays the same.
+   */
+  (void)printf("Ring buffer %lu bytes, zone %lu bytes\n",
+               (unsigned long)sizeof(struct ring_buf),
+               (unsigned long)sizeof(struct ring_buf_zone));
+  return 0;
+}
+
+int main(void) {
+  initialise_monitor_handles();
+  (void)printf("Hello, World from %s!!!\n", "ring_buf_test");
+
+  assert(ring_buf_spans_test() == 0);
+  assert(ring_buf_vectored_test() == 0);
+  assert(ring_buf_type_test() == 0);
+  assert(ring_buf_window_test() == 0);
+  assert(ring_buf_wrap_test() == 0);
+
+  _exit(0);
+  return 0;
+}
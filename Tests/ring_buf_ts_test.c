@@ -0,0 +1,140 @@
+#include "ring_buf_ts.h"
+#include "monitor_handles.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <unistd.h>
+
+/*
+ * Room for fewer records than the test puts, so circular puts drop the oldest
+ * and records wrap around the end of the buffer space.
+ */
+RING_BUF_TS_DEFINE_STATIC(test_ts, 300, 64);
+
+/*
+ * Start just short of the timestamp wrap so that the buffered records
+ * straddle it.
+ */
+#define TEST_TS_START (UINT32_MAX - 800U)
+#define TEST_TS_STEP 10U
+
+/*
+ * Substitute clock. Neither QEMU nor a test wants the DWT cycle counter. The
+ * next timestamp is always at hand for range queries.
+ */
+static ring_buf_ts_t test_ts_now = TEST_TS_START;
+
+#ifdef RING_BUF_TS_64
+/*
+ * Extend a 32-bit counter as the target clock extends the cycle counter, so
+ * that 64-bit timestamps run on past 2^32 rather than wrapping.
+ */
+static volatile uint32_t test_ts_count = TEST_TS_START;
+static struct ring_buf_ts_counter test_ts_counter = {.count = &test_ts_count};
+
+ring_buf_ts_t ring_buf_ts_clock(void) {
+  const ring_buf_ts_t now = ring_buf_ts_extend(&test_ts_counter);
+  assert(now == test_ts_now);
+  test_ts_count += TEST_TS_STEP;
+  test_ts_now += TEST_TS_STEP;
+  return now;
+}
+#else
+ring_buf_ts_t ring_buf_ts_clock(void) {
+  const ring_buf_ts_t now = test_ts_now;
+  test_ts_now += TEST_TS_STEP;
+  return now;
+}
+#endif
+
+struct test_ts_range {
+  ring_buf_ts_t t0;
+  uint32_t seq;
+};
+
+static int test_ts_yield(const struct ring_buf_span spans[2],
+                         ring_buf_item_length_t length, ring_buf_ts_t timestamp,
+                         int index, void *extra) {
+  const struct test_ts_range *range = extra;
+  uint8_t seq;
+  assert(length == 1U + timestamp % 8U);
+  assert(spans[0].size + spans[1].size == length);
+  ring_buf_span_read(spans, 0U, &seq, sizeof(seq));
+  assert(seq == (uint8_t)(range->seq + index));
+  assert((ring_buf_ts_diff_t)(timestamp - range->t0) >= 0);
+  return -EAGAIN;
+}
+
+int ring_buf_ts_test(void) {
+  uint8_t record[8] = {0U};
+  for (uint32_t seq = 0U; seq < 100U; seq++) {
+    const ring_buf_ts_t now = ring_buf_ts_clock();
+    record[0] = (uint8_t)seq;
+    assert(ring_buf_ts_put_circ(&test_ts, now, record, 1U + now % 8U) == 0);
+  }
+  const ring_buf_size_t count = ring_buf_ts_count(&test_ts);
+  assert(count > 0U && count < 64U);
+
+  /*
+   * Sequence and timestamp of the oldest record still held.
+   */
+  const uint32_t oldest = 100U - count;
+  const ring_buf_ts_t first =
+      (ring_buf_ts_t)TEST_TS_START + oldest * TEST_TS_STEP;
+#ifdef RING_BUF_TS_64
+  /*
+   * The held records straddle 2^32 without wrapping.
+   */
+  assert(first <= UINT32_MAX && test_ts_now > UINT32_MAX);
+#endif
+
+  /*
+   * Exact, between and out-of-range lower bounds.
+   */
+  assert(ring_buf_ts_lower_bound(&test_ts, first) == 0U);
+  assert(ring_buf_ts_lower_bound(&test_ts, first - 1U) == 0U);
+  assert(ring_buf_ts_lower_bound(&test_ts, first + 1U) == 1U);
+  assert(ring_buf_ts_lower_bound(&test_ts, first + 3U * TEST_TS_STEP) == 3U);
+  assert(ring_buf_ts_lower_bound(&test_ts, test_ts_now) == count);
+
+  /*
+   * Records in [t0, t1), across the timestamp wrap.
+   */
+  struct test_ts_range range = {.t0 = first + 2U * TEST_TS_STEP - 5U,
+                                .seq = oldest + 2U};
+  assert(ring_buf_ts_yield(&test_ts, range.t0, range.t0 + 6U * TEST_TS_STEP,
+                           test_ts_yield, &range) == 6);
+  assert(ring_buf_ts_yield(&test_ts, test_ts_now, test_ts_now + 100U,
+                           test_ts_yield, &range) == 0);
+
+  /*
+   * Consume the oldest record; the index follows.
+   */
+  ring_buf_ts_t timestamp;
+  ring_buf_item_length_t length;
+  assert(ring_buf_ts_get(&test_ts, &timestamp, record, &length) == 0);
+  assert(timestamp == first && record[0] == (uint8_t)oldest);
+  assert(length == 1U + first % 8U);
+  assert(ring_buf_ts_count(&test_ts) == count - 1U);
+  assert(ring_buf_ts_lower_bound(&test_ts, first + TEST_TS_STEP) == 0U);
+
+  /*
+   * A record too large for the empty buffer drops nothing.
+   */
+  static const uint8_t oversized[300];
+  assert(ring_buf_ts_put_circ(&test_ts, test_ts_now, oversized,
+                              sizeof(oversized)) == -EMSGSIZE);
+  assert(ring_buf_ts_count(&test_ts) == count - 1U);
+  (void)printf("%lu records held of 100 put\n", (unsigned long)count);
+  return 0;
+}
+
+int main(void) {
+  initialise_monitor_handles();
+  (void)printf("Hello, World from %s!!!\n", "ring_buf_ts_test");
+
+  assert(ring_buf_ts_test() == 0);
+
+  _exit(0);
+  return 0;
+}
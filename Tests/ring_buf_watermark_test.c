@@ -0,0 +1,81 @@
+#include "ring_buf.h"
+#include "ring_buf_fanout.h"
+#include "monitor_handles.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#ifndef RING_BUF_WATERMARK
+#error "ring_buf_watermark_test requires RING_BUF_WATERMARK"
+#endif
+
+static void watermark_count(struct ring_buf *buf, void *extra) {
+  (void)buf;
+  (*(int *)extra)++;
+}
+
+int ring_buf_watermark_test(void) {
+  RING_BUF_DEFINE_STATIC(buf, 16);
+  int rises = 0, falls = 0;
+  const struct ring_buf_watermark rise = {
+      .high = 8U, .rise = watermark_count, .extra = &rises};
+  const struct ring_buf_watermark fall = {
+      .low = 2U, .fall = watermark_count, .extra = &falls};
+
+  /*
+   * Rises notify once on crossing the high watermark, not again while above
+   * it, and not for a claim that is not yet acknowledged.
+   */
+  buf.watermark = &rise;
+  assert(ring_buf_put_all(&buf, NULL, 7U) == 0 && rises == 0);
+  assert(ring_buf_put(&buf, NULL, 1U) == 1U && rises == 0);
+  assert(ring_buf_put_ack(&buf, 1U) == 0 && rises == 1);
+  assert(ring_buf_put_all(&buf, NULL, 4U) == 0 && rises == 1);
+  assert(ring_buf_get_all(&buf, NULL, 10U) == 0);
+  assert(ring_buf_put_all(&buf, NULL, 6U) == 0 && rises == 2);
+
+  /*
+   * Falls likewise, on crossing the low watermark from above.
+   */
+  buf.watermark = &fall;
+  assert(ring_buf_get_all(&buf, NULL, 5U) == 0 && falls == 0);
+  assert(ring_buf_get_all(&buf, NULL, 1U) == 0 && falls == 1);
+  assert(ring_buf_get_all(&buf, NULL, 2U) == 0 && falls == 1);
+  assert(ring_buf_is_empty(&buf));
+  return 0;
+}
+
+/*
+ * Two fan-out readers. The underlying get zone only moves on when the slower
+ * reader gets, so only then does the level fall.
+ */
+RING_BUF_FANOUT_DEFINE_STATIC(test_fanout, 16, 2);
+
+int ring_buf_watermark_fanout_test(void) {
+  int falls = 0;
+  const struct ring_buf_watermark fall = {
+      .low = 2U, .fall = watermark_count, .extra = &falls};
+  ring_buf_fanout_reset(&test_fanout, 0);
+  ring_buf_fanout_reset(&test_fanout, 1);
+  test_fanout.buf->watermark = &fall;
+  assert(ring_buf_put_all(test_fanout.buf, NULL, 10U) == 0);
+  assert(ring_buf_fanout_get_all(&test_fanout, 0, NULL, 10U) == 0);
+  assert(falls == 0);
+  assert(ring_buf_fanout_get_all(&test_fanout, 1, NULL, 5U) == 0);
+  assert(falls == 0);
+  assert(ring_buf_fanout_get_all(&test_fanout, 1, NULL, 5U) == 0);
+  assert(falls == 1);
+  return 0;
+}
+
+int main(void) {
+  initialise_monitor_handles();
+  (void)printf("Hello, World from %s!!!\n", "ring_buf_watermark_test");
+
+  assert(ring_buf_watermark_test() == 0);
+  assert(ring_buf_watermark_fanout_test() == 0);
+
+  _exit(0);
+  return 0;
+}